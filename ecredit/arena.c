@@ -0,0 +1,101 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Bump-Pointer Arena
+ **/
+
+#include "arena.h"
+
+// FILE SPECIFIC FUNCTIONS
+static uint16_t align_up(uint16_t u16_n);
+
+static uint16_t align_up(uint16_t u16_n) {
+  return (u16_n + ARENA_ALIGN - 1) & ~(uint16_t) (ARENA_ALIGN - 1);
+}
+
+/**
+ * Starts an empty arena on a buffer
+ * @param a the arena
+ * @param p_buf memory to hand out (word aligned)
+ * @param u16_size bytes in p_buf
+ */
+void arena_init(struct arena *a, void *p_buf, uint16_t u16_size) {
+  a->pu8_base = (uint8_t *) p_buf;
+  a->u16_size = u16_size;
+  a->u16_used = 0;
+}
+
+/**
+ * Takes the next u16_size bytes
+ * @return them, or NULL if the arena is too full
+ */
+void* arena_alloc(struct arena *a, uint16_t u16_size) {
+  uint8_t *pu8;
+  
+  if (u16_size > a->u16_size - a->u16_used) return NULL;
+  pu8 = a->pu8_base + a->u16_used;
+  arena_commit(a, u16_size);
+  return pu8;
+}
+
+/**
+ * The free space, to fill before knowing how much will be kept
+ * (follow with arena_commit)
+ * @param pu16_left set to the bytes free
+ * @return the first free byte
+ */
+void* arena_tail(const struct arena *a, uint16_t *pu16_left) {
+  *pu16_left = a->u16_size - a->u16_used;
+  return a->pu8_base + a->u16_used;
+}
+
+/**
+ * Keeps the first u16_size bytes of the tail (at most what is free)
+ */
+void arena_commit(struct arena *a, uint16_t u16_size) {
+  uint16_t u16_left = a->u16_size - a->u16_used;
+  
+  u16_size = align_up(u16_size);
+  a->u16_used += u16_size < u16_left ? u16_size : u16_left;
+}
+
+/**
+ * @return where the arena is now, for arena_release
+ */
+uint16_t arena_mark(const struct arena *a) {
+  return a->u16_used;
+}
+
+/**
+ * Gives back everything allocated since the mark
+ */
+void arena_release(struct arena *a, uint16_t u16_mark) {
+  if (u16_mark < a->u16_used) a->u16_used = u16_mark;
+}
+
+/**
+ * Gives back everything
+ */
+void arena_reset(struct arena *a) {
+  a->u16_used = 0;
+}
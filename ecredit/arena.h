@@ -0,0 +1,55 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Bump-Pointer Arena
+ * 
+ * Hands out pieces of one caller buffer, front to back, for results
+ * whose length is only known at run time (EEPROM strings, say). An
+ * allocation is an add and a compare, nothing is freed on its own:
+ * take an arena_mark() before and arena_release() back to it after,
+ * or arena_reset() the lot. No heap is involved.
+ **/
+
+#ifndef ARENA_H
+#define	ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ARENA_ALIGN 2   // allocations start on a word (PIC24)
+
+struct arena {
+  uint8_t *pu8_base;
+  uint16_t u16_size;
+  uint16_t u16_used;
+};
+
+void arena_init(struct arena *a, void *p_buf, uint16_t u16_size);
+void* arena_alloc(struct arena *a, uint16_t u16_size);
+void* arena_tail(const struct arena *a, uint16_t *pu16_left);
+void arena_commit(struct arena *a, uint16_t u16_size);
+uint16_t arena_mark(const struct arena *a);
+void arena_release(struct arena *a, uint16_t u16_mark);
+void arena_reset(struct arena *a);
+
+#endif	/* ARENA_H */
@@ -0,0 +1,133 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Swept Collision Detection
+ * 
+ * Tests the path a dot traveled during the last frame instead of
+ * only where it ended up, so nothing tunnels through a column
+ * when the scroll speed or the fall speed goes up.
+ **/
+
+#include "collision.h"
+
+// keeps the strict (<, >) edges of the old overlap test
+#define COLLISION_EPSILON 0.001
+#define COLLISION_FAR     1000.0
+
+// FILE SPECIFIC FUNCTIONS
+static uint8_t clip_axis(float p, float d, float lo, float hi, float *t0, float *t1);
+
+/**
+ * Clips [t0, t1] to the part of p + t*d that lies inside [lo, hi]
+ * @return 1, if anything is left; otherwise, 0
+ */
+static uint8_t clip_axis(float p, float d, float lo, float hi, float *t0, float *t1) {
+  float ta, tb, tmp;
+  
+  // not moving on this axis, either always in or always out
+  if (d == 0) {
+    return (p >= lo && p <= hi);
+  }
+  
+  // time at each slab edge
+  ta = (lo - p) / d;
+  tb = (hi - p) / d;
+  if (ta > tb) {
+    tmp = ta;
+    ta = tb;
+    tb = tmp;
+  }
+  
+  // shrink the window
+  if (ta > *t0) *t0 = ta;
+  if (tb < *t1) *t1 = tb;
+  
+  return (*t0 <= *t1);
+}
+
+/**
+ * Checks if the segment (x0, y0) -> (x1, y1) touches a box
+ * @return 1, if the segment touches the box; otherwise, 0
+ */
+uint8_t collision_segment_aabb(float x0, float y0, float x1, float y1,
+                               float xmin, float ymin, float xmax, float ymax) {
+  float t0, t1;
+  t0 = 0;
+  t1 = 1;
+  
+  if (!clip_axis(x0, x1 - x0, xmin, xmax, &t0, &t1)) return 0;
+  if (!clip_axis(y0, y1 - y0, ymin, ymax, &t0, &t1)) return 0;
+  return 1;
+}
+
+/**
+ * Sweeps the player_dot against an entity_gap over the last frame
+ * 
+ * Works in the frame of the gap: the dot moves from its previous
+ * position relative to the previous gap to its current position
+ * relative to the current gap. The circle is shrunk to its center
+ * by growing the solid parts of the column by the radius.
+ * 
+ * @param pDot player_dot
+ * @param gap entity_gap
+ * @return COLLISION_HIT, COLLISION_IN_GAP or COLLISION_NONE
+ */
+uint8_t collision_swept_gap(struct player_dot *pDot, struct entity_gap *gap) {
+  float x0, y0, x1, y1, r, xmin, xmax, top, bot;
+  
+  // path of the dot, relative to the gap
+  // (whole pixels, same as what gets drawn)
+  x0 = (int) pDot->px - gap->px;
+  y0 = (int) pDot->py;
+  x1 = (int) pDot->x - gap->x;
+  y1 = (int) pDot->y;
+  r = pDot->radius;
+  
+  // the dot has to be all the way inside the column
+  xmin = r;
+  xmax = ENTITY_GAP_WIDTH - r;
+  
+  // the open part of the gap, for the center of the dot
+  top = gap->y + r;
+  bot = gap->y + gap->h - r;
+  
+  // above the gap
+  if (collision_segment_aabb(x0, y0, x1, y1,
+          xmin, -COLLISION_FAR, xmax, top - COLLISION_EPSILON)) {
+    return COLLISION_HIT;
+  }
+  
+  // below the gap
+  if (collision_segment_aabb(x0, y0, x1, y1,
+          xmin, bot + COLLISION_EPSILON, xmax, COLLISION_FAR)) {
+    return COLLISION_HIT;
+  }
+  
+  // inside the column, but through the gap
+  if (collision_segment_aabb(x0, y0, x1, y1,
+          xmin, -COLLISION_FAR, xmax, COLLISION_FAR)) {
+    return COLLISION_IN_GAP;
+  }
+  
+  return COLLISION_NONE;
+}
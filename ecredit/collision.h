@@ -0,0 +1,43 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Swept Collision Detection
+ **/
+
+#ifndef COLLISION_H
+#define	COLLISION_H
+
+#include "pic24_all.h"
+#include "pDot.h"
+#include "entity_gap.h"
+
+// RESULTS
+#define COLLISION_NONE   0  // never touched the column
+#define COLLISION_HIT    1  // hit the column above or below the gap
+#define COLLISION_IN_GAP 2  // passed through the open part of the gap
+
+uint8_t collision_segment_aabb(float x0, float y0, float x1, float y1,
+                               float xmin, float ymin, float xmax, float ymax);
+uint8_t collision_swept_gap(struct player_dot *pDot, struct entity_gap *gap);
+
+#endif	/* COLLISION_H */
@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../../lib/src/pic24_clockfreq.c ../../lib/src/pic24_configbits.c ../../lib/src/pic24_serial.c ../../lib/src/pic24_uart.c ../../lib/src/pic24_util.c ../../lib/src/pic24_timer.c ../../lib/src/pic24_adc.c ../../lib/src/pic24_spi.c ../../lib/src/pic24_i2c.c ../nokia_5110.c ../pDot.c ../entity_gap.c ../ecredit.c ../eeprom.c
+SOURCEFILES_QUOTED_IF_SPACED=../../lib/src/pic24_clockfreq.c ../../lib/src/pic24_configbits.c ../../lib/src/pic24_serial.c ../../lib/src/pic24_uart.c ../../lib/src/pic24_util.c ../../lib/src/pic24_timer.c ../../lib/src/pic24_adc.c ../../lib/src/pic24_spi.c ../../lib/src/pic24_i2c.c ../../lib/src/pic24_time.c ../../lib/src/esos_pic24_tick.c ../../lib/src/esos.c ../nokia_5110.c ../pDot.c ../entity_gap.c ../ecredit.c ../eeprom.c ../collision.c ../game.c ../replay.c ../ghost.c ../scene.c ../profile.c ../arena.c ../store.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o ${OBJECTDIR}/_ext/957557178/pic24_serial.o ${OBJECTDIR}/_ext/957557178/pic24_uart.o ${OBJECTDIR}/_ext/957557178/pic24_util.o ${OBJECTDIR}/_ext/957557178/pic24_timer.o ${OBJECTDIR}/_ext/957557178/pic24_adc.o ${OBJECTDIR}/_ext/957557178/pic24_spi.o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o ${OBJECTDIR}/_ext/1472/nokia_5110.o ${OBJECTDIR}/_ext/1472/pDot.o ${OBJECTDIR}/_ext/1472/entity_gap.o ${OBJECTDIR}/_ext/1472/ecredit.o ${OBJECTDIR}/_ext/1472/eeprom.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d ${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d ${OBJECTDIR}/_ext/957557178/pic24_serial.o.d ${OBJECTDIR}/_ext/957557178/pic24_uart.o.d ${OBJECTDIR}/_ext/957557178/pic24_util.o.d ${OBJECTDIR}/_ext/957557178/pic24_timer.o.d ${OBJECTDIR}/_ext/957557178/pic24_adc.o.d ${OBJECTDIR}/_ext/957557178/pic24_spi.o.d ${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d ${OBJECTDIR}/_ext/1472/nokia_5110.o.d ${OBJECTDIR}/_ext/1472/pDot.o.d ${OBJECTDIR}/_ext/1472/entity_gap.o.d ${OBJECTDIR}/_ext/1472/ecredit.o.d ${OBJECTDIR}/_ext/1472/eeprom.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o ${OBJECTDIR}/_ext/957557178/pic24_serial.o ${OBJECTDIR}/_ext/957557178/pic24_uart.o ${OBJECTDIR}/_ext/957557178/pic24_util.o ${OBJECTDIR}/_ext/957557178/pic24_timer.o ${OBJECTDIR}/_ext/957557178/pic24_adc.o ${OBJECTDIR}/_ext/957557178/pic24_spi.o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o ${OBJECTDIR}/_ext/957557178/pic24_time.o ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o ${OBJECTDIR}/_ext/957557178/esos.o ${OBJECTDIR}/_ext/1472/nokia_5110.o ${OBJECTDIR}/_ext/1472/pDot.o ${OBJECTDIR}/_ext/1472/entity_gap.o ${OBJECTDIR}/_ext/1472/ecredit.o ${OBJECTDIR}/_ext/1472/eeprom.o ${OBJECTDIR}/_ext/1472/collision.o ${OBJECTDIR}/_ext/1472/game.o ${OBJECTDIR}/_ext/1472/replay.o ${OBJECTDIR}/_ext/1472/ghost.o ${OBJECTDIR}/_ext/1472/scene.o ${OBJECTDIR}/_ext/1472/profile.o ${OBJECTDIR}/_ext/1472/arena.o ${OBJECTDIR}/_ext/1472/store.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d ${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d ${OBJECTDIR}/_ext/957557178/pic24_serial.o.d ${OBJECTDIR}/_ext/957557178/pic24_uart.o.d ${OBJECTDIR}/_ext/957557178/pic24_util.o.d ${OBJECTDIR}/_ext/957557178/pic24_timer.o.d ${OBJECTDIR}/_ext/957557178/pic24_adc.o.d ${OBJECTDIR}/_ext/957557178/pic24_spi.o.d ${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d ${OBJECTDIR}/_ext/957557178/pic24_time.o.d ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d ${OBJECTDIR}/_ext/957557178/esos.o.d ${OBJECTDIR}/_ext/1472/nokia_5110.o.d ${OBJECTDIR}/_ext/1472/pDot.o.d ${OBJECTDIR}/_ext/1472/entity_gap.o.d ${OBJECTDIR}/_ext/1472/ecredit.o.d ${OBJECTDIR}/_ext/1472/eeprom.o.d ${OBJECTDIR}/_ext/1472/collision.o.d ${OBJECTDIR}/_ext/1472/game.o.d ${OBJECTDIR}/_ext/1472/replay.o.d ${OBJECTDIR}/_ext/1472/ghost.o.d ${OBJECTDIR}/_ext/1472/scene.o.d ${OBJECTDIR}/_ext/1472/profile.o.d ${OBJECTDIR}/_ext/1472/arena.o.d ${OBJECTDIR}/_ext/1472/store.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o ${OBJECTDIR}/_ext/957557178/pic24_serial.o ${OBJECTDIR}/_ext/957557178/pic24_uart.o ${OBJECTDIR}/_ext/957557178/pic24_util.o ${OBJECTDIR}/_ext/957557178/pic24_timer.o ${OBJECTDIR}/_ext/957557178/pic24_adc.o ${OBJECTDIR}/_ext/957557178/pic24_spi.o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o ${OBJECTDIR}/_ext/1472/nokia_5110.o ${OBJECTDIR}/_ext/1472/pDot.o ${OBJECTDIR}/_ext/1472/entity_gap.o ${OBJECTDIR}/_ext/1472/ecredit.o ${OBJECTDIR}/_ext/1472/eeprom.o
+OBJECTFILES=${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o ${OBJECTDIR}/_ext/957557178/pic24_serial.o ${OBJECTDIR}/_ext/957557178/pic24_uart.o ${OBJECTDIR}/_ext/957557178/pic24_util.o ${OBJECTDIR}/_ext/957557178/pic24_timer.o ${OBJECTDIR}/_ext/957557178/pic24_adc.o ${OBJECTDIR}/_ext/957557178/pic24_spi.o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o ${OBJECTDIR}/_ext/957557178/pic24_time.o ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o ${OBJECTDIR}/_ext/957557178/esos.o ${OBJECTDIR}/_ext/1472/nokia_5110.o ${OBJECTDIR}/_ext/1472/pDot.o ${OBJECTDIR}/_ext/1472/entity_gap.o ${OBJECTDIR}/_ext/1472/ecredit.o ${OBJECTDIR}/_ext/1472/eeprom.o ${OBJECTDIR}/_ext/1472/collision.o ${OBJECTDIR}/_ext/1472/game.o ${OBJECTDIR}/_ext/1472/replay.o ${OBJECTDIR}/_ext/1472/ghost.o ${OBJECTDIR}/_ext/1472/scene.o ${OBJECTDIR}/_ext/1472/profile.o ${OBJECTDIR}/_ext/1472/arena.o ${OBJECTDIR}/_ext/1472/store.o
 
 # Source Files
-SOURCEFILES=../../lib/src/pic24_clockfreq.c ../../lib/src/pic24_configbits.c ../../lib/src/pic24_serial.c ../../lib/src/pic24_uart.c ../../lib/src/pic24_util.c ../../lib/src/pic24_timer.c ../../lib/src/pic24_adc.c ../../lib/src/pic24_spi.c ../../lib/src/pic24_i2c.c ../nokia_5110.c ../pDot.c ../entity_gap.c ../ecredit.c ../eeprom.c
+SOURCEFILES=../../lib/src/pic24_clockfreq.c ../../lib/src/pic24_configbits.c ../../lib/src/pic24_serial.c ../../lib/src/pic24_uart.c ../../lib/src/pic24_util.c ../../lib/src/pic24_timer.c ../../lib/src/pic24_adc.c ../../lib/src/pic24_spi.c ../../lib/src/pic24_i2c.c ../../lib/src/pic24_time.c ../../lib/src/esos_pic24_tick.c ../../lib/src/esos.c ../nokia_5110.c ../pDot.c ../entity_gap.c ../ecredit.c ../eeprom.c ../collision.c ../game.c ../replay.c ../ghost.c ../scene.c ../profile.c ../arena.c ../store.c
 
 
 CFLAGS=
@@ -98,199 +98,353 @@ ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o: ../../lib/src/pic24_clockfreq.c
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_clockfreq.c  -o ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_clockfreq.c  -o ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_configbits.o: ../../lib/src/pic24_configbits.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_configbits.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_configbits.c  -o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_configbits.c  -o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_serial.o: ../../lib/src/pic24_serial.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_serial.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_serial.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_serial.c  -o ${OBJECTDIR}/_ext/957557178/pic24_serial.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_serial.c  -o ${OBJECTDIR}/_ext/957557178/pic24_serial.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_uart.o: ../../lib/src/pic24_uart.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_uart.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_uart.c  -o ${OBJECTDIR}/_ext/957557178/pic24_uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_uart.c  -o ${OBJECTDIR}/_ext/957557178/pic24_uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_util.o: ../../lib/src/pic24_util.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_util.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_util.c  -o ${OBJECTDIR}/_ext/957557178/pic24_util.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_util.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_util.c  -o ${OBJECTDIR}/_ext/957557178/pic24_util.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_util.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_util.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_timer.o: ../../lib/src/pic24_timer.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_timer.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_timer.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_timer.c  -o ${OBJECTDIR}/_ext/957557178/pic24_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_timer.c  -o ${OBJECTDIR}/_ext/957557178/pic24_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_adc.o: ../../lib/src/pic24_adc.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_adc.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_adc.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_adc.c  -o ${OBJECTDIR}/_ext/957557178/pic24_adc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_adc.c  -o ${OBJECTDIR}/_ext/957557178/pic24_adc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_spi.o: ../../lib/src/pic24_spi.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_spi.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_spi.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_spi.c  -o ${OBJECTDIR}/_ext/957557178/pic24_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_spi.c  -o ${OBJECTDIR}/_ext/957557178/pic24_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_i2c.o: ../../lib/src/pic24_i2c.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_i2c.c  -o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_i2c.c  -o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/957557178/pic24_time.o: ../../lib/src/pic24_time.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_time.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_time.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_time.c  -o ${OBJECTDIR}/_ext/957557178/pic24_time.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_time.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_time.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o: ../../lib/src/esos_pic24_tick.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/esos_pic24_tick.c  -o ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/957557178/esos.o: ../../lib/src/esos.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/esos.c  -o ${OBJECTDIR}/_ext/957557178/esos.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/esos.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/esos.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 ${OBJECTDIR}/_ext/1472/nokia_5110.o: ../nokia_5110.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/nokia_5110.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/nokia_5110.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../nokia_5110.c  -o ${OBJECTDIR}/_ext/1472/nokia_5110.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/nokia_5110.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../nokia_5110.c  -o ${OBJECTDIR}/_ext/1472/nokia_5110.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/nokia_5110.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/nokia_5110.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/pDot.o: ../pDot.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/pDot.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/pDot.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../pDot.c  -o ${OBJECTDIR}/_ext/1472/pDot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/pDot.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../pDot.c  -o ${OBJECTDIR}/_ext/1472/pDot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/pDot.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/pDot.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/entity_gap.o: ../entity_gap.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/entity_gap.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/entity_gap.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../entity_gap.c  -o ${OBJECTDIR}/_ext/1472/entity_gap.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/entity_gap.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../entity_gap.c  -o ${OBJECTDIR}/_ext/1472/entity_gap.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/entity_gap.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/entity_gap.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/ecredit.o: ../ecredit.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/ecredit.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/ecredit.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ecredit.c  -o ${OBJECTDIR}/_ext/1472/ecredit.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ecredit.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ecredit.c  -o ${OBJECTDIR}/_ext/1472/ecredit.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ecredit.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/ecredit.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/eeprom.o: ../eeprom.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/eeprom.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/eeprom.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../eeprom.c  -o ${OBJECTDIR}/_ext/1472/eeprom.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/eeprom.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../eeprom.c  -o ${OBJECTDIR}/_ext/1472/eeprom.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/eeprom.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/eeprom.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/1472/store.o: ../store.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/store.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/store.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../store.c  -o ${OBJECTDIR}/_ext/1472/store.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/store.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/store.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/arena.o: ../arena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/arena.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/arena.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../arena.c  -o ${OBJECTDIR}/_ext/1472/arena.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/arena.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/arena.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/profile.o: ../profile.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/profile.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/profile.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../profile.c  -o ${OBJECTDIR}/_ext/1472/profile.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/profile.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/profile.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/scene.o: ../scene.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/scene.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/scene.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../scene.c  -o ${OBJECTDIR}/_ext/1472/scene.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/scene.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/scene.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/ghost.o: ../ghost.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/ghost.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/ghost.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ghost.c  -o ${OBJECTDIR}/_ext/1472/ghost.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ghost.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/ghost.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/replay.o: ../replay.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/replay.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/replay.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../replay.c  -o ${OBJECTDIR}/_ext/1472/replay.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/replay.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/replay.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/game.o: ../game.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/game.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/game.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../game.c  -o ${OBJECTDIR}/_ext/1472/game.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/game.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/game.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/collision.o: ../collision.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/collision.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/collision.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../collision.c  -o ${OBJECTDIR}/_ext/1472/collision.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/collision.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/collision.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 else
 ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o: ../../lib/src/pic24_clockfreq.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_clockfreq.c  -o ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_clockfreq.c  -o ${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_clockfreq.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_configbits.o: ../../lib/src/pic24_configbits.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_configbits.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_configbits.c  -o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_configbits.c  -o ${OBJECTDIR}/_ext/957557178/pic24_configbits.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_configbits.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_serial.o: ../../lib/src/pic24_serial.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_serial.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_serial.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_serial.c  -o ${OBJECTDIR}/_ext/957557178/pic24_serial.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_serial.c  -o ${OBJECTDIR}/_ext/957557178/pic24_serial.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_serial.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_uart.o: ../../lib/src/pic24_uart.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_uart.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_uart.c  -o ${OBJECTDIR}/_ext/957557178/pic24_uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_uart.c  -o ${OBJECTDIR}/_ext/957557178/pic24_uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_uart.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_util.o: ../../lib/src/pic24_util.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_util.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_util.c  -o ${OBJECTDIR}/_ext/957557178/pic24_util.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_util.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_util.c  -o ${OBJECTDIR}/_ext/957557178/pic24_util.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_util.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_util.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_timer.o: ../../lib/src/pic24_timer.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_timer.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_timer.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_timer.c  -o ${OBJECTDIR}/_ext/957557178/pic24_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_timer.c  -o ${OBJECTDIR}/_ext/957557178/pic24_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_timer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_adc.o: ../../lib/src/pic24_adc.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_adc.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_adc.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_adc.c  -o ${OBJECTDIR}/_ext/957557178/pic24_adc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_adc.c  -o ${OBJECTDIR}/_ext/957557178/pic24_adc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_adc.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_spi.o: ../../lib/src/pic24_spi.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_spi.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_spi.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_spi.c  -o ${OBJECTDIR}/_ext/957557178/pic24_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_spi.c  -o ${OBJECTDIR}/_ext/957557178/pic24_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_spi.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/957557178/pic24_i2c.o: ../../lib/src/pic24_i2c.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d 
 	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_i2c.c  -o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_i2c.c  -o ${OBJECTDIR}/_ext/957557178/pic24_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_i2c.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/957557178/pic24_time.o: ../../lib/src/pic24_time.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_time.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/pic24_time.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/pic24_time.c  -o ${OBJECTDIR}/_ext/957557178/pic24_time.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/pic24_time.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/pic24_time.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o: ../../lib/src/esos_pic24_tick.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/esos_pic24_tick.c  -o ${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/esos_pic24_tick.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/957557178/esos.o: ../../lib/src/esos.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/957557178" 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos.o.d 
+	@${RM} ${OBJECTDIR}/_ext/957557178/esos.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../lib/src/esos.c  -o ${OBJECTDIR}/_ext/957557178/esos.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/957557178/esos.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/957557178/esos.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 ${OBJECTDIR}/_ext/1472/nokia_5110.o: ../nokia_5110.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/nokia_5110.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/nokia_5110.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../nokia_5110.c  -o ${OBJECTDIR}/_ext/1472/nokia_5110.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/nokia_5110.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../nokia_5110.c  -o ${OBJECTDIR}/_ext/1472/nokia_5110.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/nokia_5110.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/nokia_5110.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/pDot.o: ../pDot.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/pDot.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/pDot.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../pDot.c  -o ${OBJECTDIR}/_ext/1472/pDot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/pDot.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../pDot.c  -o ${OBJECTDIR}/_ext/1472/pDot.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/pDot.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/pDot.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/entity_gap.o: ../entity_gap.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/entity_gap.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/entity_gap.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../entity_gap.c  -o ${OBJECTDIR}/_ext/1472/entity_gap.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/entity_gap.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../entity_gap.c  -o ${OBJECTDIR}/_ext/1472/entity_gap.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/entity_gap.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/entity_gap.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/ecredit.o: ../ecredit.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/ecredit.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/ecredit.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ecredit.c  -o ${OBJECTDIR}/_ext/1472/ecredit.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ecredit.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ecredit.c  -o ${OBJECTDIR}/_ext/1472/ecredit.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ecredit.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/ecredit.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 ${OBJECTDIR}/_ext/1472/eeprom.o: ../eeprom.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
 	@${RM} ${OBJECTDIR}/_ext/1472/eeprom.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1472/eeprom.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  ../eeprom.c  -o ${OBJECTDIR}/_ext/1472/eeprom.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/eeprom.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -msmart-io=1 -Wall -msfr-warn=off  
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../eeprom.c  -o ${OBJECTDIR}/_ext/1472/eeprom.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/eeprom.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/eeprom.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/1472/store.o: ../store.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/store.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/store.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../store.c  -o ${OBJECTDIR}/_ext/1472/store.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/store.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/store.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/arena.o: ../arena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/arena.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/arena.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../arena.c  -o ${OBJECTDIR}/_ext/1472/arena.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/arena.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/arena.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/profile.o: ../profile.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/profile.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/profile.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../profile.c  -o ${OBJECTDIR}/_ext/1472/profile.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/profile.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/profile.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/scene.o: ../scene.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/scene.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/scene.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../scene.c  -o ${OBJECTDIR}/_ext/1472/scene.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/scene.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/scene.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/ghost.o: ../ghost.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/ghost.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/ghost.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../ghost.c  -o ${OBJECTDIR}/_ext/1472/ghost.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/ghost.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/ghost.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/replay.o: ../replay.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/replay.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/replay.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../replay.c  -o ${OBJECTDIR}/_ext/1472/replay.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/replay.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/replay.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/game.o: ../game.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/game.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/game.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../game.c  -o ${OBJECTDIR}/_ext/1472/game.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/game.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/game.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1472/collision.o: ../collision.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1472" 
+	@${RM} ${OBJECTDIR}/_ext/1472/collision.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1472/collision.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../collision.c  -o ${OBJECTDIR}/_ext/1472/collision.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1472/collision.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -O0 -I"../../lib/include" -DSPI1_TX_INTERRUPT -DSPI1_TX_FIFO_SIZE=128 -DSPI1_TX_DC_PIN=_LATB12 -DUSE_HEARTBEAT_TICK=1 -DUSE_CLOCK_PROFILES=1 -DI2C1_INTERRUPT -DI2C1_SCL_TRIS=_TRISB8 -DI2C1_SCL_LAT=_LATB8 -DI2C1_SDA_TRIS=_TRISB9 -DI2C1_SDA_LAT=_LATB9 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1472/collision.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -22,341 +22,860 @@
 
 /**
  * MAIN PROGRAM
+ * 
+ * Cooperative tasks (ESOS), none of which spin on slow I/O:
+ *   input      debounces PB once a tick
+ *   scene      runs the scenes (boot, title, ready, play, game over)
+ *   render     sends the frame to the LCD a bank at a time, each one
+ *              a short burst through the SPI1 FIFO
+ *   eeprom     writes the high score to the store, then queued saves,
+ *              a page at a time (sent by the MI2C1 interrupt),
+ *              yielding through each write cycle
+ *   telemetry  prints a status line on UART1 every second
+ *   clock      drops to the FRC once the LCD is idle
+ * 
+ * Frames are pipelined: RENDER() latches video memory for render_task
+ * (NOK_PRESENT), so the scenes can go on to the next frame's input,
+ * physics and drawing while this one is still going out. A second
+ * RENDER() before the LCD is free holds the scenes until it is.
+ * 
+ * Between scheduler passes the core sits in Idle until an interrupt:
+ * the 1 ms tick (which also blinks the heartbeat LED), a PB change,
+ * or SPI/I2C/UART.
+ * 
+ * Game frames are worked out and sent at full speed (60 MHz); in
+ * between, the core runs from the bare FRC (3.685 MHz), with the
+ * tick, UART, I2C and SPI clocks set again for it at each switch.
+ * Telemetry reports the time at each, and the energy per frame.
  **/
 
 #include "pic24_all.h"
 #include <stdio.h>
+#include "esos.h"
 #include "eeprom.h"
+#include "store.h"
 #include "nokia_5110.h"
-#include "pDot.h"
-#include "entity_gap.h"
+#include "game.h"
+#include "replay.h"
+#include "ghost.h"
+#include "scene.h"
+#include "profile.h"
+
+#define PLAY_FRAME_MS     80    // one game frame
+#define PB_DEBOUNCE_TICKS 3     // PB must hold a new state this long
+#define PB_LONG_MS        1000  // a hold this long toggles the overlay
+#define TELEMETRY_MS      1000
+#define EEPROM_JOBS       16    // one game over queues at most 9, one
+                                // slot stays empty to tell full from idle
+#define GHOST_JOBS        5     // EEPROM_QUEUE calls per save, below
+#define REPLAY_JOBS       4
+#define CLOCK_IDLE_MS     5     // LCD idle this long: drop to the FRC
+                                // (longer than a title animation step)
+#define SUPPLY_MV         3300
+#define CLOCK_FULL_UA     30000 // supply current at each clock profile,
+#define CLOCK_LOW_UA      5000  // rough: set from a meter on the board
+#define KEY_HIGH_SCORE    0     // record store keys
+#define OLD_HIGH_SCORE    0x1337 // where the high score was kept before
+
+// a run of bytes to write to EEPROM
+struct eeprom_job {
+  uint16_t u16_addr;
+  const uint8_t *pu8_data;
+  uint16_t u16_len;
+};
 
 // FILE SPECIFIC FUNCTIONS
 static void CONFIG_PB();
-static void animation_hello();
-static void draw_and_update_gap(struct entity_gap*);
-static uint8_t check_for_collision(struct player_dot *pDot, struct entity_gap *gaps, uint8_t u8_cnt);
-static void DELAY_MS_PB(uint16_t ms);
+static void WAIT_PB_START();
+static uint8_t WAIT_PB_DONE(uint16_t ms);
+static void BUS_TO_EEPROM();
+static void BUS_TO_LCD();
+static void GHOST_REFILL();
+static void RENDER();
+static void LATCH_FRAME();
+static uint8_t EEPROM_QUEUE(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
+static uint8_t EEPROM_PENDING();
+static uint8_t EEPROM_ROOM(uint8_t u8_jobs);
+static void SET_CLOCK(uint8_t u8_profile);
+static void CLOCK_UP();
+static void CLOCK_ACCOUNT();
+
+static ESOS_USER_TASK(input_task);
+static ESOS_USER_TASK(scene_task);
+static ESOS_USER_TASK(render_task);
+static ESOS_USER_TASK(eeprom_task);
+static ESOS_USER_TASK(telemetry_task);
+static ESOS_USER_TASK(clock_task);
+
+static void boot_enter();
+static void title_enter();
+static void title_tick();
+static void ready_enter();
+static void ready_tick();
+static void play_draw();
+static void play_enter();
+static void play_tick();
+static void over_enter();
+static void over_tick();
+
+// SCENES
+static const struct scene SCENE_BOOT  = { boot_enter,  NULL,       NULL };
+static const struct scene SCENE_TITLE = { title_enter, title_tick, NULL };
+static const struct scene SCENE_READY = { ready_enter, ready_tick, NULL };
+static const struct scene SCENE_PLAY  = { play_enter,  play_tick,  NULL };
+static const struct scene SCENE_OVER  = { over_enter,  over_tick,  NULL };
 
 // FILE SPECIFIC VARIABLES
-static uint8_t u8_bootrun = 1;
-static uint8_t u8_running = 1;
-static uint8_t u8_player_score = 0;
-static uint8_t u8_ingap = 99;
 static uint8_t u8_high_score = 0;
+static uint8_t u8_playback = 0;
+static struct replay replay;
+static uint8_t u8_ghost = 0;
+static struct ghost_rec ghostRec;
+static struct ghost_play ghostPlay;
+static struct game game;          // the game in play
+static uint8_t u8_stage;          // step of a multi-step scene
+static uint8_t u8_i;              // generic count for animating
+static uint32_t u32_waitStart;    // tick a wait began
+static uint8_t u8_pbArmed;        // PB released since then
+static uint32_t u32_nextFrame;    // tick the next game frame is due
+static volatile uint8_t u8_pb;    // debounced PB
+static uint8_t u8_render;         // a frame is being sent
+static uint8_t u8_renderNext;     // video memory is waiting to be sent
+static uint32_t u32_frameDue;     // tick the frame being drawn is for
+static uint32_t u32_sendingDue;   // ... and the one being sent
+static uint16_t u16_sendingStart; // profile_now() it was latched
+static uint16_t u16_framesShown;  // frames sent to the LCD
+static uint16_t u16_latMax;       // worst due-to-shown ticks
+static uint32_t u32_latSum;       // ... and their total, for the average
+static uint8_t u8_overlay;        // draw the profiler's FPS/ms readout
+static uint32_t u32_clockBusy;    // tick full speed was last needed
+static uint32_t u32_clockMark;    // micros() time was counted to
+static uint32_t au32_clockUs[2];  // time at each clock profile
+
+// EEPROM write queue
+static struct eeprom_job aJobs[EEPROM_JOBS];
+static uint8_t u8_jobHead, u8_jobTail;
+static uint8_t u8_scoreSave;      // u8_high_score is to go in the store
+static const uint8_t u8_erased = 0xFF, u8_zero = 0x00;
+static uint8_t au8_ghostHeader[GHOST_HEADER];
+static uint8_t au8_replayHeader[REPLAY_HEADER];
 
 /**
  * Enables PB pins (RB3)
+ * PB_RAW() reads the pin, PB_PRESSED() the debounced state
+ * A change wakes the core from Idle (input_task does the rest)
  */
-#define PB_PRESSED() _RB3 == 0
+#define PB_RAW() (_RB3 == 0)
+#define PB_PRESSED() (u8_pb)
 static void CONFIG_PB()  {
   CONFIG_RB3_AS_DIG_INPUT();
   ENABLE_RB3_PULLUP();
   DELAY_US(1);
+  
+  ENABLE_RB3_CN_INTERRUPT();
+  _CNIF = 0;
+  _CNIP = 2;
+  _CNIE = 1;
 }
 
 /**
- * Delays for MS but allows PB to break
+ * PB change: nothing to do but wake up
  */
-static void DELAY_MS_PB(uint16_t ms) {
-  // if the button is on, ignore until release
-  uint8_t waiting;
-  
-  while (--ms > 0) {
-    // update waiting
-    if (waiting) waiting = (!PB_PRESSED());
-    
-    // if button pressed and not waiting
-    if (!PB_PRESSED() && !waiting) {
-      break;
-    }
-    DELAY_MS(1);
+void _ISR _CNInterrupt(void) {
+  _CNIF = 0;
+}
+
+/**
+ * Starts a wait that PB can break (see WAIT_PB_DONE)
+ */
+static void WAIT_PB_START() {
+  u32_waitStart = esos_GetSystemTick();
+  u8_pbArmed = 0;
+}
+
+/**
+ * Checks a wait that PB can break
+ * If the button is on at the start, it's ignored until released
+ * @param ms length of the wait
+ * @return 1, if the time is up or PB was pressed; 0, if still waiting
+ */
+static uint8_t WAIT_PB_DONE(uint16_t ms) {
+  if (!PB_PRESSED()) {
+    u8_pbArmed = 1;
+  } else if (u8_pbArmed) {
+    return 1;
   }
+  return esos_GetSystemTick() - u32_waitStart >= ms;
 }
 
 /**
- * Main Program
- * @return 
+ * Hands the shared pins from the LCD (SPI1) to the EEPROM (I2C1)
+ * Waits for the LCD's queue, and any queued I2C1 transaction, to
+ * empty first
  */
-int main(void) {  
-  // init general
-  configBasic(HELLO_MSG);
-  CONFIG_EEPROM();
-  
-  // read the high score from EEPROM
-  DELAY_MS(20);
-  u8_high_score = EEPROM_READ_SPECIFIC(0x1337);
-  DELAY_MS(20);
+static void BUS_TO_EEPROM() {
+  EEPROM_ASYNC_DRAIN();
+  NOK_SPI_FLUSH();
+  SPI1STATbits.SPIEN = 0;
+  I2C1CONbits.I2CEN = 1;
+}
+
+/**
+ * Hands the shared pins back to the LCD, once any queued I2C1
+ * transaction is over
+ */
+static void BUS_TO_LCD() {
+  EEPROM_ASYNC_DRAIN();
   I2C1CONbits.I2CEN = 0;
-  DELAY_MS(20);
-  
-  init:
-  CONFIG_NOK();
-  CONFIG_PB();
-  
-  // randomizer seed
-  srand(20);
+  SPI1STATbits.SPIEN = 1;
+}
 
-  // init screen
-  NOK_BACKLIGHT(1);
-  NOK_INIT();
-  animation_hello();
-  NOK_CLEAR();
-  // floor line
-  NOK_LINE(0, 48, 84, 48, 1);
+/**
+ * Tops up the ghost's read-ahead buffer
+ * Borrows the bus from the LCD for one sequential read
+ */
+static void GHOST_REFILL() {
+  BUS_TO_EEPROM();
+  ghost_play_fill(&ghostPlay);
+  BUS_TO_LCD();
+}
+
+/**
+ * Hands video memory to render_task
+ * If the last frame is still going out, this one waits in video
+ * memory (and scene_task won't tick again until it is latched)
+ */
+static void RENDER() {
+  CLOCK_UP();
+  if (u8_render) {
+    u8_renderNext = 1;
+  } else {
+    LATCH_FRAME();
+    u8_render = 1;
+  }
+}
+
+/**
+ * Latches video memory for render_task, noting when
+ */
+static void LATCH_FRAME() {
+  NOK_PRESENT();
+  u32_sendingDue = u32_frameDue;
+  u16_sendingStart = profile_now();
+}
+
+/**
+ * Queues bytes for eeprom_task to write, in order
+ * The bytes must stay put until EEPROM_PENDING() is 0
+ * @return 0, if the queue is full and nothing was queued
+ */
+static uint8_t EEPROM_QUEUE(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  struct eeprom_job *job = &aJobs[u8_jobHead];
   
-  // store and init the player dot
-  struct player_dot pDot;
-  player_dot_init(&pDot, 6, 20, 0, 0, 2);
-  NOK_CIRCLE(pDot.x, pDot.y, pDot.radius, 1, 1);
+  if (u16_len == 0) return 1;
+  if (!EEPROM_ROOM(1)) return 0;
+  job->u16_addr = u16_addr;
+  job->pu8_data = pu8_data;
+  job->u16_len = u16_len;
+  u8_jobHead = (u8_jobHead + 1) % EEPROM_JOBS;
+  return 1;
+}
+
+/**
+ * @return jobs not yet written
+ */
+static uint8_t EEPROM_PENDING() {
+  return (u8_jobHead + EEPROM_JOBS - u8_jobTail) % EEPROM_JOBS;
+}
+
+/**
+ * A save is several jobs that only make sense together, so check for
+ * room for all of them before queuing the first
+ * @return 1, if u8_jobs more jobs fit in the queue
+ */
+static uint8_t EEPROM_ROOM(uint8_t u8_jobs) {
+  return EEPROM_PENDING() + u8_jobs < EEPROM_JOBS;
+}
+
+/**
+ * Switches the clock profile, and sets everything clocked from FCY
+ * again for the new speed: the tick, the clock, UART1, I2C1 and SPI1
+ * Waits for UART1 and the LCD's queue to empty first, and leaves
+ * the shared pins with whichever had them
+ * @param u8_profile CLOCK_PROFILE_FULL or CLOCK_PROFILE_LOW
+ */
+static void SET_CLOCK(uint8_t u8_profile) {
+  uint8_t u8_lcd;
   
-  // store the gaps for traveling through
-  struct entity_gap gaps[5];
+  if (getClockProfile() == u8_profile) return;
+  CLOCK_ACCOUNT();
+  while (!IS_TRANSMIT_COMPLETE_UART1());
+  u8_lcd = SPI1STATbits.SPIEN;
+  BUS_TO_EEPROM();
   
-  // times the release of gaps
-  uint8_t release_timer;
-  release_timer = 35;
+  setClockProfile(u8_profile);
+  __esos_hw_RetuneSystemTick();
+  retuneTime32();
+  U1BRG = compute_brg(FCY_NOW, DEFAULT_BRGH1, DEFAULT_BAUDRATE);
+  CONFIG_EEPROM();
+  NOK_RETUNE();
   
-  // counts the number of gaps
-  // keeps track of open indexes
-  uint8_t count, idx;
-  count = 0;
-  idx = 0;
+  if (u8_lcd) BUS_TO_LCD();
+}
+
+/**
+ * Full speed, for drawing and sending a frame
+ * (clock_task drops back once the LCD has been idle a while)
+ */
+static void CLOCK_UP() {
+  u32_clockBusy = esos_GetSystemTick();
+  SET_CLOCK(CLOCK_PROFILE_FULL);
+}
+
+/**
+ * Charges the time since the last call to the current clock profile
+ */
+static void CLOCK_ACCOUNT() {
+  uint32_t u32_now = micros();
   
-  // generic count for looping
-  uint8_t u8_i;
+  au32_clockUs[getClockProfile()] += u32_now - u32_clockMark;
+  u32_clockMark = u32_now;
+}
+
+/**
+ * Set up the PIC and the tasks (called once by ESOS)
+ */
+void user_init(void) {
+  // init general
+  configBasic(HELLO_MSG);
+  CONFIG_EEPROM();
+  CONFIG_PB();
+  configTime32();
+  profile_init();
   
-  // convert score to string
-  char score[6];
+  esos_RegisterTask(input_task);
+  esos_RegisterTask(scene_task);
+  esos_RegisterTask(render_task);
+  esos_RegisterTask(eeprom_task);
+  esos_RegisterTask(telemetry_task);
+  esos_RegisterTask(clock_task);
   
-  // ask if ready
-  NOK_MOVE_CURSOR(0, 0);
-  NOK_STR("READY?\n\n\n\nPress button\nto fly!");
-  NOK_UPDATE();
+  scene_set(&SCENE_BOOT);
+}
+
+// TASKS ////////////////////////////////////////
+
+/**
+ * PB changes state after PB_DEBOUNCE_TICKS of agreeing samples
+ * Holding it PB_LONG_MS toggles the profiler overlay
+ */
+static ESOS_USER_TASK(input_task) {
+  static uint8_t u8_count;
+  static uint16_t u16_held;
   
-  // wait for button press
-  while (!PB_PRESSED()) doHeartbeat();
+  ESOS_TASK_BEGIN();
+  while (1) {
+    if (PB_RAW() != u8_pb) {
+      if (++u8_count >= PB_DEBOUNCE_TICKS) {
+        u8_pb = !u8_pb;
+        u8_count = 0;
+        u16_held = 0;
+      }
+    } else {
+      u8_count = 0;
+    }
+    if (u8_pb && u16_held < PB_LONG_MS && ++u16_held == PB_LONG_MS) {
+      u8_overlay = !u8_overlay;
+    }
+    ESOS_TASK_WAIT_TICKS(1);
+  }
+  ESOS_TASK_END();
+}
+
+/**
+ * Ticks the current scene every SCENE_TICK_MS
+ */
+static ESOS_USER_TASK(scene_task) {
+  ESOS_TASK_BEGIN();
+  while (1) {
+    // don't draw over a frame that is still waiting to go out
+    ESOS_TASK_WAIT_WHILE(u8_renderNext);
+    u32_frameDue = esos_GetSystemTick();
+    scene_tick();
+    ESOS_TASK_WAIT_TICKS(SCENE_TICK_MS);
+  }
+  ESOS_TASK_END();
+}
+
+/**
+ * Sends the latched frame a bank at a time, yielding in between
+ * Each bank is one burst of 16-bit frames through the 8-deep FIFO
+ * (NOK_UPDATE_BANK), so the bus runs at the SPI clock
+ * Latency is counted from the tick the frame was due to the tick
+ * its last bank went out
+ */
+static ESOS_USER_TASK(render_task) {
+  static uint8_t u8_bank;
+  uint16_t u16_lat;
   
-  // game loop
-  while (u8_running) {
-    // clear and draw floor
-    NOK_CLEAR();
-    NOK_LINE(0, 47, 83, 47, 1);
-    
-    // draw and update gaps
-    for (u8_i = 0; u8_i < count; u8_i++) {
-      draw_and_update_gap(&gaps[u8_i]);
-      
-      // if out, open for overwrite
-      if (gaps[u8_i].x < -6) idx = u8_i;
+  ESOS_TASK_BEGIN();
+  while (1) {
+    ESOS_TASK_WAIT_UNTIL(u8_render);
+    for (u8_bank = 0; u8_bank < 6; u8_bank++) {
+      // once any queued command is out, and the EEPROM isn't
+      // holding the bus
+      ESOS_TASK_WAIT_UNTIL(NOK_SPI_IDLE() && SPI1STATbits.SPIEN);
+      NOK_UPDATE_BANK(u8_bank);
     }
     
-    // if not full, make gaps
-    if (count < 4) {
-      
-      // check if time to release new gap
-      if (release_timer >= 20) {
-        // set gap position
-        entity_gap_init_randy(&gaps[idx], 84);
-        
-        // clear the timer
-        release_timer = 0;
-        
-        // increment
-        count = max(idx, count);
-        idx++;
-      } else {
-        // increment time
-        release_timer++;
-      }
-      
+    profile_add(PROFILE_LCD, profile_now() - u16_sendingStart);
+    u16_lat = esos_GetSystemTick() - u32_sendingDue;
+    if (u16_lat > u16_latMax) u16_latMax = u16_lat;
+    u32_latSum += u16_lat;
+    u16_framesShown++;
+    
+    // straight on to a frame that was waiting
+    if (u8_renderNext) {
+      LATCH_FRAME();
+      u8_renderNext = 0;
+    } else {
+      u8_render = 0;
     }
+  }
+  ESOS_TASK_END();
+}
+
+/**
+ * Writes a new high score to the record store, then the queue, a page
+ * at a time
+ * Each page borrows the bus from the LCD; a queued page goes out from
+ * the MI2C1 interrupt, so the scenes go on drawing meanwhile (only
+ * the LCD waits for the bus). The write cycle is then ACK polled
+ * once a pass, so the other tasks run while it programs
+ * A chip that doesn't come back in EEPROM_POLL_MS drops the job (or
+ * ends the store's put); a page stuck on the bus that long is given
+ * up, and the bus freed
+ */
+static ESOS_USER_TASK(eeprom_task) {
+  static struct eeprom_job *job;
+  static struct store_write put;
+  static struct eeprom_async op;
+  static uint32_t u32_deadline;
+  static uint8_t u8_n, u8_sent;
+  
+  ESOS_TASK_BEGIN();
+  while (1) {
+    ESOS_TASK_WAIT_UNTIL(EEPROM_PENDING() || u8_scoreSave || store_busy());
+    ESOS_TASK_WAIT_UNTIL(NOK_SPI_IDLE());
+    BUS_TO_EEPROM();
     
-    // draw and update the player dot
-    NOK_CIRCLE(pDot.x, pDot.y, pDot.radius, 1, 1);
+    // the store's writes first, as the put came before the saves (it
+    // may read a record it is moving, on the way)
+    if (u8_scoreSave && !store_busy()) {
+      store_put_start(KEY_HIGH_SCORE, &u8_high_score, 1);
+      u8_scoreSave = 0;
+    }
+    job = NULL;
+    if (store_step(&put)) {
+      u8_n = EEPROM_WRITE_PAGE_ASYNC(&op, put.u16_addr, put.pu8_data, put.u8_len, NULL, NULL);
+    } else if (EEPROM_PENDING()) {
+      job = &aJobs[u8_jobTail];
+      u8_n = EEPROM_WRITE_PAGE_ASYNC(&op, job->u16_addr, job->pu8_data, job->u16_len, NULL, NULL);
+    } else {
+      // the put is over
+      BUS_TO_LCD();
+      continue;
+    }
+    u32_deadline = deadlineUs(EEPROM_POLL_MS * 1000L);
+    ESOS_TASK_WAIT_UNTIL(!u8_n || EEPROM_ASYNC_DONE(&op) || isDeadlinePassed(u32_deadline));
+    if (u8_n && !EEPROM_ASYNC_DONE(&op)) EEPROM_ASYNC_ABORT();
+    u8_sent = u8_n && EEPROM_ASYNC_OK(&op);
+    if (u8_sent && job) {
+      // on to the next page of the job
+      job->u16_addr += u8_n;
+      job->pu8_data += u8_n;
+      job->u16_len -= u8_n;
+    }
+    // else the chip was busy, or the bus stuck: again, once it answers
+    BUS_TO_LCD();
     
-    // convert score to string and show
-    sprintf(score, "%d", u8_player_score); 
-    NOK_MOVE_CURSOR(42-5, 0);
-    NOK_STR(score);
+    u32_deadline = deadlineUs(EEPROM_POLL_MS * 1000L);
+    do {
+      ESOS_TASK_YIELD();
+      ESOS_TASK_WAIT_UNTIL(NOK_SPI_IDLE());
+      BUS_TO_EEPROM();
+      EEPROM_POLL_ASYNC(&op);
+      ESOS_TASK_WAIT_UNTIL(EEPROM_ASYNC_DONE(&op) || isDeadlinePassed(u32_deadline));
+      if (!EEPROM_ASYNC_DONE(&op)) EEPROM_ASYNC_ABORT();
+      BUS_TO_LCD();
+    } while (!EEPROM_ASYNC_OK(&op) && !isDeadlinePassed(u32_deadline));
     
-    // update screen
-    NOK_UPDATE();
+    if (job) {
+      if (job->u16_len == 0 || !EEPROM_ASYNC_OK(&op)) {
+        u8_jobTail = (u8_jobTail + 1) % EEPROM_JOBS;
+      }
+    } else if (!EEPROM_ASYNC_OK(&op) || u8_sent) {
+      // the store takes the page once it is programmed
+      store_step_done(EEPROM_ASYNC_OK(&op));
+    }
+  }
+  ESOS_TASK_END();
+}
+
+/**
+ * Status line on UART1, without waiting on a full TX buffer
+ * fps and lat (average/worst ms from due to shown) cover the
+ * last TELEMETRY_MS, as do clk (% of the time at full speed) and
+ * uj (microjoules at full speed/on the FRC, per frame shown, or for
+ * the whole second if none were)
+ */
+static ESOS_USER_TASK(telemetry_task) {
+  static char sz_line[112];
+  static char *psz_c;
+  uint16_t u16_frames;
+  uint32_t u32_fullMs, u32_lowMs;
+  uint32_t u32_fullUj, u32_lowUj;
+  uint16_t u16_full;
+  
+  ESOS_TASK_BEGIN();
+  while (1) {
+    ESOS_TASK_WAIT_TICKS(TELEMETRY_MS);
+    u16_frames = u16_framesShown;
     
-    // check for collision with gap or floor
-    if (check_for_collision(&pDot, gaps, count) ||
-        (pDot.y >= 43 && pDot.dy == 0)) {
-      
-      // white dot
-      NOK_CIRCLE(pDot.x, pDot.y, pDot.radius, 1, 0);
-      NOK_CIRCLE(pDot.x, pDot.y, pDot.radius, 0, 1);
-      // GAME OVER!
-      u8_running = 0;
+    CLOCK_ACCOUNT();
+    u32_fullMs = au32_clockUs[CLOCK_PROFILE_FULL] / 1000;
+    u32_lowMs = au32_clockUs[CLOCK_PROFILE_LOW] / 1000;
+    u16_full = (u32_fullMs + u32_lowMs) ? u32_fullMs * 100 / (u32_fullMs + u32_lowMs) : 0;
+    // uA x ms = nC, / 1000 x mV = nJ, / 1000 = uJ
+    u32_fullUj = u32_fullMs * CLOCK_FULL_UA / 1000 * SUPPLY_MV / 1000;
+    u32_lowUj = u32_lowMs * CLOCK_LOW_UA / 1000 * SUPPLY_MV / 1000;
+    if (u16_frames) {
+      u32_fullUj /= u16_frames;
+      u32_lowUj /= u16_frames;
     }
     
-    // update player's physics
-    player_dot_update(&pDot, PB_PRESSED());
+    sprintf(sz_line, "t=%lu fps=%u lat=%u/%u clk=%u%% uj=%lu/%lu "
+            "score=%u frame=%u eeprom=%u\n",
+            (unsigned long) esos_GetSystemTick(), u16_frames,
+            u16_frames ? (uint16_t) (u32_latSum / u16_frames) : 0,
+            u16_latMax, u16_full,
+            (unsigned long) u32_fullUj, (unsigned long) u32_lowUj,
+            game.u8_score, game.u16_frame, EEPROM_PENDING());
+    u16_framesShown = 0;
+    u32_latSum = 0;
+    u16_latMax = 0;
+    au32_clockUs[CLOCK_PROFILE_FULL] = 0;
+    au32_clockUs[CLOCK_PROFILE_LOW] = 0;
     
-    // delay
-    DELAY_MS(80);
+    for (psz_c = sz_line; *psz_c; psz_c++) {
+      ESOS_TASK_WAIT_WHILE(IS_TRANSMIT_BUFFER_FULL_UART1());
+      outChar1(*psz_c);
+    }
   }
-  
-  // flash the LCD back light
-  for (u8_i = 0; u8_i < 4; u8_i++) {
-    NOK_BACKLIGHT_TOGGLE();
-    DELAY_MS(50);
+  ESOS_TASK_END();
+}
+
+/**
+ * Counts the time at each clock profile, and drops to the FRC once
+ * the LCD has had nothing to send for CLOCK_IDLE_MS (RENDER and the
+ * game frames put it back up)
+ */
+static ESOS_USER_TASK(clock_task) {
+  ESOS_TASK_BEGIN();
+  while (1) {
+    CLOCK_ACCOUNT();
+    if (u8_render || !NOK_SPI_IDLE()) {
+      u32_clockBusy = esos_GetSystemTick();
+    } else if (esos_GetSystemTick() - u32_clockBusy >= CLOCK_IDLE_MS) {
+      SET_CLOCK(CLOCK_PROFILE_LOW);
+    }
+    ESOS_TASK_YIELD();
+  }
+  ESOS_TASK_END();
+}
+
+// BOOT /////////////////////////////////////////
+
+/**
+ * EEPROM and LCD init, once
+ */
+static void boot_enter() {
+  // read the high score from the record store, once the EEPROM
+  // answers (or from where it was, if the store has none yet)
+  EEPROM_WAIT_WRITE();
+  store_init();
+  if (store_get(KEY_HIGH_SCORE, &u8_high_score, 1) != 1) {
+    u8_high_score = EEPROM_READ_SPECIFIC(OLD_HIGH_SCORE);
   }
   
-  // show "game over"
-  NOK_MOVE_CURSOR(6, 2);
-  NOK_STR("game over :(");
+  // holding the button at power on plays the last game back
+  if (PB_RAW()) u8_playback = replay_load(&replay, REPLAY_ADDR);
+  I2C1CONbits.I2CEN = 0;
   
-  // save the high score
-  if (u8_player_score > u8_high_score) {
-    NOK_STR("\nNEW HIGH SCORE");
-    NOK_UPDATE();
-    DELAY_MS_PB(5000);
-    
-    SPI1STATbits.SPIEN = 0;
-    DELAY_MS(20);
-    u8_high_score = u8_player_score;
-    I2C1CONbits.I2CEN = 1;
-    EEPROM_WRITE_SPECIFIC(0x1337, u8_high_score);
-    DELAY_MS(20);
-    I2C1CONbits.I2CEN = 0;
-  } else {
-    NOK_UPDATE();
-    DELAY_MS_PB(5000);
-  }
+  // init screen
+  CONFIG_NOK();
+  NOK_BACKLIGHT(1);
+  NOK_INIT();
   
-  // reset the score and running bit
-  u8_player_score = 0;
-  u8_running = 1; 
-  goto init;
+  scene_set(&SCENE_TITLE);
 }
 
+// TITLE ////////////////////////////////////////
+
 /**
  * Title animation
- * Shows title, if first boot
- * Shows high score
+ * Shows title and high score
  */
-static void animation_hello() {
+static void title_enter() {
   NOK_CLEAR();
-  uint8_t u8_i;
+  u8_stage = 0;
+  u8_i = 0;
+}
+
+static void title_tick() {
+  char score[6];
   
-  // fill the screen up
-  for (u8_i = 0; u8_i < 48; u8_i++) {
-    NOK_LINE(0, u8_i, 84, u8_i, 1);
-    NOK_UPDATE();
-    DELAY_MS(4);
+  switch (u8_stage) {
+    // fill the screen up
+    case 0:
+      NOK_LINE(0, u8_i, 84, u8_i, 1);
+      RENDER();
+      if (++u8_i == 48) {
+        u8_stage++;
+        u8_i = 1;
+      }
+      break;
+    
+    // circle explosion from center
+    case 1:
+      NOK_CIRCLE(84/2, 48/2, u8_i, 0, 0);
+      RENDER();
+      if (++u8_i == 84) u8_stage++;
+      break;
+    
+    // title
+    case 2:
+      NOK_CLEAR();
+      NOK_MOVE_CURSOR(0, 0);
+      NOK_STR("BUBBLE COURSE\n"
+              "v1.0\n\n"
+              "BY:\n"
+              "Jordan S.\n"
+              "Elisabeth A.");  
+      RENDER();
+      WAIT_PB_START();
+      u8_stage++;
+      break;
+    
+    case 4:
+      NOK_CLEAR();
+      NOK_MOVE_CURSOR(0, 0);
+      NOK_STR("inspired by\n\n"
+              "FLAPPY BIRD\n\n\n"
+              "R.I.P. 2014");  
+      RENDER();
+      WAIT_PB_START();
+      u8_stage++;
+      break;
+    
+    // display high score
+    case 6:
+      sprintf(score, "%d", u8_high_score);
+      NOK_CLEAR();
+      NOK_MOVE_CURSOR(0, 0);
+      NOK_STR("highest score:\n");
+      NOK_STR(score);
+      RENDER();
+      WAIT_PB_START();
+      u8_stage++;
+      break;
+    
+    // wait on a screen
+    case 3:
+    case 5:
+      if (WAIT_PB_DONE(3000)) u8_stage++;
+      break;
+    
+    default:
+      if (WAIT_PB_DONE(3000)) scene_set(&SCENE_READY);
+      break;
   }
+}
+
+// READY ////////////////////////////////////////
+
+/**
+ * New game, waits for a press
+ */
+static void ready_enter() {
+  // load the start of the best run's ghost
+  BUS_TO_EEPROM();
+  u8_ghost = ghost_play_start(&ghostPlay, GHOST_ADDR);
+  BUS_TO_LCD();
+  ghost_record_start(&ghostRec);
   
-  // circle explosion from center
-  for (u8_i = 1; u8_i < 84; u8_i++) {
-    NOK_CIRCLE(84/2, 48/2, u8_i, 0, 0);
-    NOK_UPDATE();
-    DELAY_MS(4);
+  // same course every time
+  if (u8_playback) {
+    game_init(&game, replay.u16_seed);
+    replay_play_start(&replay);
+  } else {
+    game_init(&game, 20);
+    replay_record_start(&replay, 20);
   }
   
-  // show title if first boot
-  if (u8_bootrun == 1) {
-    u8_bootrun = 0;
-    
-    NOK_CLEAR();
-    NOK_MOVE_CURSOR(0, 0);
-    NOK_STR("BUBBLE COURSE\n"
-            "v1.0\n\n"
-            "BY:\n"
-            "Jordan S.\n"
-            "Elisabeth A.");  
-    NOK_UPDATE();
-    DELAY_MS_PB(3000);
-
-    NOK_CLEAR();
-    NOK_MOVE_CURSOR(0, 0);
-    NOK_STR("inspired by\n\n"
-            "FLAPPY BIRD\n\n\n"
-            "R.I.P. 2014");  
-    NOK_UPDATE();
-    DELAY_MS_PB(3000);
-  }
+  NOK_CLEAR();
+  // floor line
+  NOK_LINE(0, 48, 84, 48, 1);
   
-  // convert high score to string
-  char score[6];
-  sprintf(score, "%d", u8_high_score);
+  // show the player dot
+  NOK_CIRCLE(game.pDot.x, game.pDot.y, game.pDot.radius, 1, 1);
   
-  // display high score
-  NOK_CLEAR();
+  // ask if ready
   NOK_MOVE_CURSOR(0, 0);
-  NOK_STR("highest score:\n");
-  NOK_STR(score);
-  NOK_UPDATE();
-  DELAY_MS_PB(3000);
+  NOK_STR(u8_playback ? "REPLAY\n\n\n\nPress button\nto watch" :
+                        "READY?\n\n\n\nPress button\nto fly!");
+  RENDER();
+}
+
+static void ready_tick() {
+  if (PB_PRESSED()) scene_set(&SCENE_PLAY);
 }
 
+// PLAY /////////////////////////////////////////
+
 /**
- * Draws gap entity and calls update function
+ * Draws the game, with the ghost, into video memory
+ * and the overlay: frames a second and CPU ms a frame (averages)
  */
-static void draw_and_update_gap(struct entity_gap *entity) {
-  // store the x, y of gap
-  int8_t x, y;
-  x = entity->x;
-  y = entity->y;
+static void play_draw() {
+  int8_t i8_ghostY;
+  uint32_t u32_us;
+  uint16_t u16_fps;
+  char sz_stat[16];
   
-  // check if in range to draw
-  if (x > -6 && x < 84) {
-    // draw full rectangle (BLACK)
-    NOK_RECT(max(min(x, 84), 0), 0, max(min(x+6, 84), 0), 48  , 1, 1);
-    
-    // draw gap (WHITE)
-    NOK_RECT(max(min(x, 84), 0), y, max(min(x+6, 84), 0), y+15, 1, 0);
+  game_draw(&game);
+  if (u8_ghost && ghost_play_next(&ghostPlay, &i8_ghostY)) {
+    NOK_EMPTY_CIRCLE(game.pDot.x, i8_ghostY, game.pDot.radius, 1, 1);
   }
-  
-  // update
-  entity_gap_update(entity);
+  profile_lap(PROFILE_PLAYER);
+  if (u8_overlay) {
+    u32_us = PROFILE_US(profile_stat(PROFILE_INTERVAL)->u16_avg);
+    u16_fps = u32_us ? 1000000L / u32_us : 0;
+    u32_us = PROFILE_US(profile_stat(PROFILE_BUSY)->u16_avg);
+    sprintf(sz_stat, "%u %u.%u", u16_fps, (uint16_t) (u32_us / 1000),
+            (uint16_t) (u32_us / 100 % 10));
+    NOK_MOVE_CURSOR(0, 0);
+    NOK_STR(sz_stat);
+    profile_lap(PROFILE_TEXT);
+  }
+  ghost_record(&ghostRec, game.pDot.y);
+  if (u8_ghost && ghost_play_needs_fill(&ghostPlay)) GHOST_REFILL();
+}
+
+static void play_enter() {
+  u32_nextFrame = esos_GetSystemTick();
+  profile_restart();
+  play_draw();
 }
 
 /**
- * Checks for collision of player_dot with any entity_gaps
- * @param pDot player_dot
- * @param gaps array of entity_gaps
- * @param u8_cnt number of gaps
- * @return 1, if collision; otherwise, 0
+ * One game frame every PLAY_FRAME_MS
+ * The frame drawn last time is shown as soon as it's due, then the
+ * next one is worked out and drawn while it goes out
  */
-static uint8_t check_for_collision(struct player_dot *pDot, struct entity_gap *gaps, uint8_t u8_cnt) {
-  uint8_t u8_i, px, py, pr;
-  struct entity_gap cur_gap;
+static void play_tick() {
+  uint8_t u8_pressed;
   
-  // store the x,y,r of player
-  px = pDot->x;
-  py = pDot->y;
-  pr = pDot->radius;
+  if ((int32_t) (esos_GetSystemTick() - u32_nextFrame) < 0) return;
+  CLOCK_UP();
+  u32_frameDue = u32_nextFrame;
+  u32_nextFrame += PLAY_FRAME_MS;
+  RENDER();
+  
+  // next input, from the button or the recording
+  if (u8_playback) {
+    u8_pressed = replay_play(&replay);
+  } else {
+    u8_pressed = PB_PRESSED();
+    replay_record(&replay, u8_pressed);
+  }
   
-  // loop through all gaps
-  for (u8_i = 0; u8_i < u8_cnt; u8_i++) {
-    // get current gap
-    cur_gap = gaps[u8_i];
+  // move everything, check for collisions
+  if (!game_step(&game, u8_pressed)) {
+    game_draw_crash(&game);
+    scene_set(&SCENE_OVER);
+    return;
+  }
+  play_draw();
+  profile_frame();
+}
+
+// GAME OVER ////////////////////////////////////
+
+static void over_enter() {
+  u8_stage = 0;
+  u8_i = 0;
+  u32_waitStart = esos_GetSystemTick();
+}
+
+static void over_tick() {
+  switch (u8_stage) {
+    // flash the LCD back light, 4 toggles 50 ms apart
+    case 0:
+      if (esos_GetSystemTick() - u32_waitStart < 50 && u8_i > 0) break;
+      u32_waitStart = esos_GetSystemTick();
+      NOK_BACKLIGHT_TOGGLE();
+      if (++u8_i == 4) u8_stage++;
+      break;
     
-    // if player is in x of gap
-    if (cur_gap.x <= px - pr && cur_gap.x + 6 >= px + pr) {
-      // if player is above or below gap
-      if (cur_gap.y > py - pr || cur_gap.y + 15 < py + pr) {
-        // COLLISION!
-        return 1;
+    // show "game over", queue the saves
+    case 1:
+      NOK_MOVE_CURSOR(6, 2);
+      NOK_STR("game over :(");
+      
+      // the high score and its ghost (in the order ghost_save uses)
+      if (game.u8_score > u8_high_score && !u8_playback) {
+        NOK_STR("\nNEW HIGH SCORE");
+        u8_high_score = game.u8_score;
+        u8_scoreSave = 1;
+        
+        ghost_header(&ghostRec, au8_ghostHeader);
+        if (EEPROM_ROOM(GHOST_JOBS)) {
+          EEPROM_QUEUE(GHOST_ADDR, &u8_erased, 1);
+          EEPROM_QUEUE(GHOST_ADDR + 2, &au8_ghostHeader[2], 1);
+          EEPROM_QUEUE(GHOST_ADDR + GHOST_HEADER, ghostRec.au8_nibbles, ghostRec.u16_frames / 2);
+          EEPROM_QUEUE(GHOST_ADDR + 1, &au8_ghostHeader[1], 1);
+          EEPROM_QUEUE(GHOST_ADDR, &au8_ghostHeader[0], 1);
+        }
+      }
+      RENDER();
+      
+      // keep the game for playback (in the order replay_save uses),
+      // or go back to playing after one
+      if (u8_playback) {
+        u8_playback = 0;
       } else {
-        // note in gap
-        u8_ingap = u8_i;
+        replay_record_end(&replay, game.u8_score);
+        replay_header(&replay, au8_replayHeader);
+        if (EEPROM_ROOM(REPLAY_JOBS)) {
+          EEPROM_QUEUE(REPLAY_ADDR, &u8_zero, 1);
+          EEPROM_QUEUE(REPLAY_ADDR + REPLAY_HEADER, replay.au8_runs, replay.u16_runs);
+          EEPROM_QUEUE(REPLAY_ADDR + 1, &au8_replayHeader[1], REPLAY_HEADER - 1);
+          EEPROM_QUEUE(REPLAY_ADDR, &au8_replayHeader[0], 1);
+        }
       }
-    } else {
-      // exited gap safely
-      if (u8_ingap == u8_i) {
-        // up the score
-        u8_player_score++;
-        u8_ingap = 99;
-      } 
-    }
+      
+      WAIT_PB_START();
+      u8_stage++;
+      break;
+    
+    case 2:
+      if (WAIT_PB_DONE(5000)) u8_stage++;
+      break;
+    
+    // start over, once the saves are out of the buffers
+    default:
+      if (!EEPROM_PENDING() && !u8_scoreSave && !store_busy()) scene_set(&SCENE_READY);
+      break;
   }
-  
-  // no collisions
-  return 0;
-}
\ No newline at end of file
+}
@@ -28,8 +28,21 @@
 
 #define EEPROM_ADDR 0xA2
 
+#define EEPROM_BLOCK 0x8000  // a sequential read wraps within one
+#define EEPROM_STR_CHUNK 16  // bytes read at a time looking for the end
+#define EEPROM_RETRIES 3     // tries again at a transaction the bus spoils
+#define EEPROM_BACKOFF_MS 1  // before the first retry; doubles for each
+
 // FILE SPECIFIC FUNCTIONS
 static void split_address(uint16_t u16_addr, uint8_t* u8_addrHi, uint8_t* u8_addrLo);
+static uint8_t SEND_ADDRESS(uint16_t u16_addr);
+static uint8_t FINISH(uint8_t u8_ack);
+static uint8_t RETRY(uint8_t u8_ack, uint8_t u8_try);
+static uint8_t READ_SEQUENTIAL(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len);
+static uint8_t WRITE_BYTES(uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_n);
+static void ASYNC_HEAD(struct eeprom_async *op, uint16_t u16_addr,
+                       void (*pfn_done)(I2C_XFER *), void *p_arg);
+static void ASYNC_STEP(struct eeprom_async *op, uint8_t u8_op, uint8_t *pu8_data, uint16_t u16_len);
 
 /**
  * Split a 16-bit address into two 8-bit parts
@@ -56,52 +69,205 @@ uint16_t EEPROM_GET_ADDR(uint16_t u16_addr) {
 }
 
 /**
- * Reads one byte from the specified address
+ * Starts a transaction and sends the control byte and the address
+ * @return I2C_ACK; I2C_NAK, if the chip didn't answer; or
+ *         I2C_TIMEOUT, if the bus is stuck
  */
-uint8_t EEPROM_READ_SPECIFIC(uint16_t u16_addr) {
-  uint8_t u8_addrHi, u8_addrLo, u8_IC2Addr, u8_byte;
+static uint8_t SEND_ADDRESS(uint16_t u16_addr) {
+  uint8_t u8_addrHi, u8_addrLo, u8_ack;
   
   // split the address; using pointers
   split_address(u16_addr, &u8_addrHi, &u8_addrLo);
+  
+  u8_ack = tryStartI2C1();                                               // start I2C transaction
+  if (u8_ack == I2C_ACK) u8_ack = tryPutI2C1(EEPROM_GET_ADDR(u16_addr)); // send the I2C device address
+  if (u8_ack == I2C_ACK) u8_ack = tryPutI2C1(u8_addrHi);                 // send first half
+  if (u8_ack == I2C_ACK) u8_ack = tryPutI2C1(u8_addrLo);                 // send second half
+  return u8_ack;
+}
+
+/**
+ * Ends a transaction with a stop, unless the bus is stuck
+ * @param u8_ack how the transaction went
+ * @return u8_ack, or I2C_TIMEOUT if the stop didn't go out
+ */
+static uint8_t FINISH(uint8_t u8_ack) {
+  if (u8_ack != I2C_TIMEOUT && tryStopI2C1() != I2C_ACK) return I2C_TIMEOUT;
+  return u8_ack;
+}
 
-  // get the I2C address
-  u8_IC2Addr = EEPROM_GET_ADDR(u16_addr);
+/**
+ * After a failed transaction: frees a stuck bus, then waits a little
+ * longer each time for the glitch (or a write cycle) to pass
+ * @param u8_ack how the transaction ended
+ * @param u8_try retries so far
+ * @return 1, to try again; 0, if it went through or the tries are up
+ */
+static uint8_t RETRY(uint8_t u8_ack, uint8_t u8_try) {
+  if (u8_ack == I2C_ACK || u8_try == EEPROM_RETRIES) return 0;
+  if (u8_ack == I2C_TIMEOUT) recoverI2C1();
+  DELAY_MS(EEPROM_BACKOFF_MS << u8_try);
+  return 1;
+}
 
-  // define the address
-  startI2C1();                 // start I2C transaction
-  putI2C1(u8_IC2Addr);         // send the I2C device address
-  putI2C1(u8_addrHi);          // send first half
-  putI2C1(u8_addrLo);          // send second half
-
-  // read from address
-  rstartI2C1();                // restart I2C transaction
-  putI2C1(u8_IC2Addr | 0x01);  // send I2C device address; set LSb for READ
-  u8_byte = getI2C1(1);        // read; send NAK to indicate READ finished
-  stopI2C1();                  // end I2C transaction
-  
-  // return byte that was read
+/**
+ * Checks, without waiting, whether the last write cycle is over
+ * The chip doesn't ACK its address while it programs, so this is
+ * one ACK poll: start, control byte (no NAK check), stop
+ * A stuck bus is freed, and counts as still writing
+ * @return 1, if the chip is ready; 0, if still writing
+ */
+uint8_t EEPROM_WRITE_DONE(void) {
+  uint8_t u8_ack;
+  
+  u8_ack = tryStartI2C1();
+  if (u8_ack == I2C_ACK) u8_ack = tryPutI2C1(EEPROM_ADDR);
+  u8_ack = FINISH(u8_ack);
+  if (u8_ack == I2C_TIMEOUT) recoverI2C1();
+  return u8_ack == I2C_ACK;
+}
+
+/**
+ * Waits (ACK polling) for the write cycle to end
+ * Usually shorter than EEPROM_WRITE_MS
+ * @return 1, if the chip is ready; 0, if EEPROM_POLL_MS went by
+ */
+uint8_t EEPROM_WAIT_WRITE(void) {
+  uint32_t u32_deadline = deadlineUs(EEPROM_POLL_MS * 1000L);
+  
+  while (!EEPROM_WRITE_DONE()) {
+    if (isDeadlinePassed(u32_deadline)) return 0;
+  }
+  return 1;
+}
+
+/**
+ * Reads one byte from the specified address
+ * @return the byte; 0xFF (erased) if the chip didn't answer
+ */
+uint8_t EEPROM_READ_SPECIFIC(uint16_t u16_addr) {
+  uint8_t u8_byte = 0xFF;
+  
+  EEPROM_READ_BLOCK(u16_addr, &u8_byte, 1);
   return u8_byte;
 }
 
+/**
+ * Reads len bytes starting at the address in one sequential read
+ * The address is set once, then the chip auto-increments; each byte
+ * is ACKed but the last. Reads need no write cycle, so no delays
+ * A read that reaches 0x8000 (the block select) goes on in a second
+ * sequential read, since the chip would wrap within the block
+ * A read the bus spoils is tried again, up to EEPROM_RETRIES times
+ * @param u16_addr first address
+ * @param pu8_buf gets the bytes
+ * @param u16_len number of bytes
+ * @return 1, if all read; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_READ_BLOCK(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len) {
+  uint16_t u16_n;
+  uint8_t u8_ack, u8_try;
+  
+  while (u16_len > 0) {
+    // up to the end of the 32 KB block
+    u16_n = EEPROM_BLOCK - (u16_addr % EEPROM_BLOCK);
+    if (u16_n > u16_len) u16_n = u16_len;
+    
+    for (u8_try = 0; RETRY(u8_ack = READ_SEQUENTIAL(u16_addr, pu8_buf, u16_n), u8_try); u8_try++);
+    if (u8_ack != I2C_ACK) return 0;
+    u16_addr += u16_n;
+    pu8_buf += u16_n;
+    u16_len -= u16_n;
+  }
+  return 1;
+}
+
+/**
+ * One sequential read, within a 32 KB block
+ * @param u16_len number of bytes, at least 1
+ * @return I2C_ACK, I2C_NAK or I2C_TIMEOUT, as SEND_ADDRESS
+ */
+static uint8_t READ_SEQUENTIAL(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len) {
+  uint8_t u8_ack;
+  
+  // define the address
+  u8_ack = SEND_ADDRESS(u16_addr);
+  
+  // read; ACK every byte but the last
+  if (u8_ack == I2C_ACK) u8_ack = tryRstartI2C1();                              // restart I2C transaction
+  if (u8_ack == I2C_ACK) u8_ack = tryPutI2C1(EEPROM_GET_ADDR(u16_addr) | 0x01); // set LSb for READ
+  while (u8_ack == I2C_ACK && u16_len-- > 0) {
+    u8_ack = tryGetI2C1(u16_len ? I2C_ACK : I2C_NAK, pu8_buf++);  // NAK to indicate READ finished
+  }
+  return FINISH(u8_ack);       // end I2C transaction
+}
+
 /**
  * Writes one byte to the specified address
+ * and waits for the write cycle
+ * @return 1, if written; 0, if the chip stopped answering
  */
-void EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte) {
-  uint8_t u8_addrHi, u8_addrLo, u8_IC2Addr;
+uint8_t EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte) {
+  if (!EEPROM_WRITE_PAGE(u16_addr, &u8_byte, 1)) return 0;
+  return EEPROM_WAIT_WRITE();
+}
 
-  // split the address; using pointers
-  split_address(u16_addr, &u8_addrHi, &u8_addrLo);
+/**
+ * One page write: the address, then the bytes
+ * The write cycle starts at the stop
+ * @return I2C_ACK, I2C_NAK or I2C_TIMEOUT, as SEND_ADDRESS
+ */
+static uint8_t WRITE_BYTES(uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_n) {
+  uint8_t u8_ack;
+  
+  u8_ack = SEND_ADDRESS(u16_addr);
+  while (u8_ack == I2C_ACK && u8_n-- > 0) {
+    u8_ack = tryPutI2C1(*pu8_data++);  // send data
+  }
+  return FINISH(u8_ack);               // end I2C transaction
+}
+
+/**
+ * Writes bytes in one transaction, up to the end of the page
+ * (pages are EEPROM_PAGE bytes, so one never crosses 0x8000)
+ * Doesn't wait for the write cycle: see EEPROM_WRITE_DONE
+ * A write the bus spoils (or a chip still busy) is tried again,
+ * up to EEPROM_RETRIES times
+ * @param u16_addr first address
+ * @param pu8_data bytes to write
+ * @param u16_len bytes wanted written, at least 1
+ * @return bytes written: u16_len, or fewer if the page ends first;
+ *         0, if the chip stopped answering
+ */
+uint8_t EEPROM_WRITE_PAGE(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  uint8_t u8_n, u8_ack, u8_try;
+  
+  // stop at the end of the page
+  u8_n = EEPROM_PAGE - (u16_addr % EEPROM_PAGE);
+  if (u16_len < u8_n) u8_n = u16_len;
   
-  // get the I2C address
-  u8_IC2Addr = EEPROM_GET_ADDR(u16_addr);
+  for (u8_try = 0; RETRY(u8_ack = WRITE_BYTES(u16_addr, pu8_data, u8_n), u8_try); u8_try++);
+  return u8_ack == I2C_ACK ? u8_n : 0;
+}
 
-  // send data
-  startI2C1();          // start I2C transaction
-  putI2C1(u8_IC2Addr);  // send the I2C device address
-  putI2C1(u8_addrHi);   // send 1st half
-  putI2C1(u8_addrLo);   // send 2nd half
-  putI2C1(u8_byte);     // send data
-  stopI2C1();           // end I2C transaction
+/**
+ * Writes bytes a page at a time, waiting out each write cycle
+ * @param u16_addr first address
+ * @param pu8_data bytes to write
+ * @param u16_len number of bytes
+ * @return 1, if all written; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_WRITE_BLOCK(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  uint8_t u8_n;
+  
+  while (u16_len > 0) {
+    u8_n = EEPROM_WRITE_PAGE(u16_addr, pu8_data, u16_len);
+    if (u8_n == 0 || !EEPROM_WAIT_WRITE()) return 0;
+    u16_addr += u8_n;
+    pu8_data += u8_n;
+    u16_len -= u8_n;
+  }
+  return 1;
 }
 
 /**
@@ -109,77 +275,79 @@ void EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte) {
  * ends with a 0x00 byte
  */
 void EEPROM_WRITESTR_SPECIFIC(uint16_t u16_addr, const char *data) {
-  uint8_t u8_i, u8_len, u8_char;
-  u8_len = strlen(data);
-  
-  // loop through string
-  for (u8_i = 0; u8_i < u8_len; u8_i++, u16_addr++) {
-    // get current byte
-    u8_char = data[u8_i] & 0xFF;
-    if (u8_char == '\0') break;
-    
-    // write the byte
-    EEPROM_WRITE_SPECIFIC(u16_addr, u8_char);
-    DELAY_MS(5);
-  }
-  
-  // end of string blank
-  EEPROM_WRITE_SPECIFIC(u16_addr, 0x00);
+  // the string and its end blank, a page at a time
+  EEPROM_WRITE_BLOCK(u16_addr, (const uint8_t *) data, strlen(data) + 1);
 }
 
 /**
  * Reads a char array from between two addresses
+ * (from included, to not), in one sequential read
+ * Stops short if sz_buf is full; no heap, and time bounded by u16_size
+ * @param sz_buf where to put the string (always ended)
+ * @param u16_size bytes in sz_buf, the end included (at least 1)
+ * @return length of the string in sz_buf
  */
-char* EEPROM_READSTR_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr) {
-  uint8_t u8_curChar = EEPROM_READ_SPECIFIC(u16_fromAddr);
-  uint8_t u8_i;
-  u8_i = 0;
+uint16_t EEPROM_READSTR_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr, char *sz_buf, uint16_t u16_size) {
+  uint16_t u16_len = u16_toAddr > u16_fromAddr ? u16_toAddr - u16_fromAddr : 0;
   
-  // dynamic char string
-  char *returnChars;
-  returnChars = (char *) malloc(sizeof(char));
+  // what fits
+  if (u16_len > u16_size - 1) u16_len = u16_size - 1;
   
   // read in the string
-  while (u16_fromAddr < u16_toAddr) {
-    realloc(returnChars, u8_i++);
-    returnChars[u8_i] = u8_curChar;
-    u8_curChar = EEPROM_READ_SPECIFIC(u16_fromAddr++);
-    DELAY_MS(5);
-  }
+  EEPROM_READ_BLOCK(u16_fromAddr, (uint8_t *) sz_buf, u16_len);
   
   // end the string
-  returnChars[u8_i] = '\0';
+  sz_buf[u16_len] = '\0';
   
-  return returnChars;
+  return u16_len;
 }
 
 /**
  * Reads a char array from an address
- * until a null char is returned
+ * until a null char (or an erased 0xFF) is returned
+ * Reads EEPROM_STR_CHUNK bytes at a time, sequentially, straight into
+ * sz_buf; stops short if it is full, so never reads past u16_size
+ * @param sz_buf where to put the string (always ended)
+ * @param u16_size bytes in sz_buf, the end included (at least 1)
+ * @return length of the string in sz_buf
  */
-char* EEPROM_READSTR_UNTILNULL(uint16_t u16_addr) {
-  uint8_t u8_byte = EEPROM_READ_SPECIFIC(u16_addr);
-  uint8_t u8_i;
-  u8_i = 0;
+uint16_t EEPROM_READSTR_UNTILNULL(uint16_t u16_addr, char *sz_buf, uint16_t u16_size) {
+  uint16_t u16_len = 0;
+  uint16_t u16_n;
   
-  // dynamic char string
-  char *returnChars;
-  returnChars = (char *) malloc(sizeof(char));
+  while (u16_len < u16_size - 1) {
+    u16_n = u16_size - 1 - u16_len;
+    if (u16_n > EEPROM_STR_CHUNK) u16_n = EEPROM_STR_CHUNK;
+    EEPROM_READ_BLOCK(u16_addr + u16_len, (uint8_t *) &sz_buf[u16_len], u16_n);
     
-  while (u8_byte != 0xFF && u8_byte != 0x00) { 
-    realloc(returnChars, u8_i++);
-    returnChars[u8_i] = u8_byte; 
-    
-    // increment
-    u16_addr++;
-    u8_byte = EEPROM_READ_SPECIFIC(u16_addr);
-    DELAY_MS(5);
-  };
+    // look for the end in this chunk
+    for (; u16_n > 0; u16_n--, u16_len++) {
+      if (sz_buf[u16_len] == (char) 0xFF || sz_buf[u16_len] == '\0') {
+        // end the string
+        sz_buf[u16_len] = '\0';
+        return u16_len;
+      }
+    }
+  }
   
-  // end the string
-  returnChars[u8_i] = '\0';
+  // out of room
+  sz_buf[u16_len] = '\0';
+  return u16_len;
+}
+
+/**
+ * Reads a char array, as EEPROM_READSTR_UNTILNULL, into the free end
+ * of an arena, keeping only what the string takes
+ * @return the string, or NULL if the arena had no room for a byte
+ */
+char* EEPROM_READSTR_ARENA(struct arena *a, uint16_t u16_addr) {
+  uint16_t u16_left;
+  char *sz;
   
-  return returnChars;
+  sz = (char *) arena_tail(a, &u16_left);
+  if (u16_left == 0) return NULL;
+  arena_commit(a, EEPROM_READSTR_UNTILNULL(u16_addr, sz, u16_left) + 1);
+  return sz;
 }
 
 /**
@@ -187,12 +355,153 @@ char* EEPROM_READSTR_UNTILNULL(uint16_t u16_addr) {
  * Effectively erasing the data
  */
 void EEPROM_ZERO_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr) {  
-  while (u16_fromAddr < u16_toAddr) {
-    // output
-    EEPROM_WRITE_SPECIFIC(u16_fromAddr, 0x00);
-    DELAY_MS(5);
+  if (u16_fromAddr < u16_toAddr) EEPROM_FILL(u16_fromAddr, u16_toAddr, 0x00, NULL);
+}
+
+/**
+ * Writes one value between two addresses (from included, to not),
+ * a page at a time from one buffer: a part page up to the first page
+ * boundary, whole pages, then a part page (pages never cross 0x8000)
+ * Each write cycle is ACK polled, so a page takes what the chip needs
+ * @param u16_fromAddr first address
+ * @param u16_toAddr end, not included; 0x0000 for the end of the chip
+ * @param u8_value byte to write
+ * @param pfn_progress called after each page is sent, while it
+ *        programs: the bus is free then, so the LCD can have it (if
+ *        it's handed back); or NULL
+ * @return 1, if all written; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_FILL(uint16_t u16_fromAddr, uint16_t u16_toAddr, uint8_t u8_value, eeprom_progress_t pfn_progress) {
+  uint8_t au8_fill[EEPROM_PAGE];
+  uint32_t u32_addr = u16_fromAddr;
+  uint32_t u32_end = u16_toAddr ? u16_toAddr : 0x10000UL;
+  uint32_t u32_left;
+  uint8_t u8_n;
+  
+  memset(au8_fill, u8_value, EEPROM_PAGE);
+  while (u32_addr < u32_end) {
+    // up to the end of the page (EEPROM_WRITE_PAGE stops there)
+    u32_left = u32_end - u32_addr;
+    u8_n = EEPROM_WRITE_PAGE(u32_addr, au8_fill, u32_left > EEPROM_PAGE ? EEPROM_PAGE : u32_left);
+    if (u8_n == 0) return 0;
+    u32_addr += u8_n;
     
-    // increment
-    u16_fromAddr++;
-  };
+    if (pfn_progress) pfn_progress(u32_addr - u16_fromAddr, u32_end - u16_fromAddr);
+    if (!EEPROM_WAIT_WRITE()) return 0;
+  }
+  return 1;
+}
+
+/**
+ * Starts an async transaction: a start, then the control byte and
+ * the address
+ */
+static void ASYNC_HEAD(struct eeprom_async *op, uint16_t u16_addr,
+                       void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  op->au8_head[0] = EEPROM_GET_ADDR(u16_addr);
+  split_address(u16_addr, &op->au8_head[1], &op->au8_head[2]);
+  op->xfer.pst_steps = op->aSteps;
+  op->xfer.u8_steps = 0;
+  op->xfer.pfn_done = pfn_done;
+  op->xfer.p_arg = p_arg;
+  ASYNC_STEP(op, I2C_OP_START, NULL, 0);
+  ASYNC_STEP(op, I2C_OP_WRITE, op->au8_head, 3);
+}
+
+/**
+ * Adds a step to an async transaction
+ */
+static void ASYNC_STEP(struct eeprom_async *op, uint8_t u8_op, uint8_t *pu8_data, uint16_t u16_len) {
+  I2C_STEP *step = &op->aSteps[op->xfer.u8_steps++];
+  
+  step->u8_op = u8_op;
+  step->pu8_data = pu8_data;
+  step->u16_len = u16_len;
+}
+
+/**
+ * Queues a sequential read, as EEPROM_READ_BLOCK but only up to the
+ * end of the 32 KB block, and returns at once; the MI2C1 interrupt
+ * runs it, then calls pfn_done (from the interrupt)
+ * @param op transaction; stays put until EEPROM_ASYNC_DONE
+ * @param pu8_buf gets the bytes
+ * @param u16_len bytes wanted, at least 1
+ * @param pfn_done called when it's over, or NULL
+ * @param p_arg for pfn_done (in op->xfer.p_arg)
+ * @return bytes that will be read; 0 if the queue was full
+ */
+uint16_t EEPROM_READ_ASYNC(struct eeprom_async *op, uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len,
+                           void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  uint16_t u16_n;
+  
+  // up to the end of the 32 KB block
+  u16_n = EEPROM_BLOCK - (u16_addr % EEPROM_BLOCK);
+  if (u16_n > u16_len) u16_n = u16_len;
+  
+  ASYNC_HEAD(op, u16_addr, pfn_done, p_arg);
+  op->u8_readCtl = op->au8_head[0] | 0x01;  // set LSb for READ
+  ASYNC_STEP(op, I2C_OP_START, NULL, 0);    // a restart
+  ASYNC_STEP(op, I2C_OP_WRITE, &op->u8_readCtl, 1);
+  ASYNC_STEP(op, I2C_OP_READ, pu8_buf, u16_n);
+  ASYNC_STEP(op, I2C_OP_STOP, NULL, 0);
+  
+  return queueI2C1(&op->xfer) ? u16_n : 0;
+}
+
+/**
+ * Queues a page write, as EEPROM_WRITE_PAGE, and returns at once
+ * The write cycle starts at the stop: see EEPROM_POLL_ASYNC
+ * @param op transaction; stays put until EEPROM_ASYNC_DONE
+ * @param pu8_data bytes to write; stay put too
+ * @param u16_len bytes wanted written, at least 1
+ * @param pfn_done called when it's over, or NULL
+ * @param p_arg for pfn_done (in op->xfer.p_arg)
+ * @return bytes that will be written, up to the end of the page;
+ *         0 if the queue was full
+ */
+uint8_t EEPROM_WRITE_PAGE_ASYNC(struct eeprom_async *op, uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len,
+                                void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  uint8_t u8_n;
+  
+  // stop at the end of the page
+  u8_n = EEPROM_PAGE - (u16_addr % EEPROM_PAGE);
+  if (u16_len < u8_n) u8_n = u16_len;
+  
+  ASYNC_HEAD(op, u16_addr, pfn_done, p_arg);
+  ASYNC_STEP(op, I2C_OP_WRITE, (uint8_t *) pu8_data, u8_n);  // only read from
+  ASYNC_STEP(op, I2C_OP_STOP, NULL, 0);
+  
+  return queueI2C1(&op->xfer) ? u8_n : 0;
+}
+
+/**
+ * Queues one ACK poll, as EEPROM_WRITE_DONE: once it's done,
+ * EEPROM_ASYNC_OK means the write cycle is over
+ * @param op transaction; stays put until EEPROM_ASYNC_DONE
+ * @return 1, if queued; 0 if the queue was full
+ */
+uint8_t EEPROM_POLL_ASYNC(struct eeprom_async *op) {
+  ASYNC_HEAD(op, 0, NULL, NULL);
+  op->aSteps[1].u16_len = 1;  // the control byte alone
+  ASYNC_STEP(op, I2C_OP_STOP, NULL, 0);
+  
+  return queueI2C1(&op->xfer);
+}
+
+/**
+ * Waits for the queued transactions to finish, up to EEPROM_POLL_MS;
+ * if the bus stops answering they're given up (I2C_XFER_TIMEOUT) and
+ * the bus is freed
+ * @return 1, if they finished; 0, if given up
+ */
+uint8_t EEPROM_ASYNC_DRAIN(void) {
+  uint32_t u32_deadline = deadlineUs(EEPROM_POLL_MS * 1000L);
+  
+  while (!EEPROM_ASYNC_IDLE()) {
+    if (isDeadlinePassed(u32_deadline)) {
+      abortQueueI2C1();
+      return 0;
+    }
+  }
+  return 1;
 }
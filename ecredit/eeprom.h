@@ -25,27 +25,66 @@
  **/
 
 #include "pic24_all.h"
+#include "arena.h"
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
 #ifndef EEPROM_H
 #define	EEPROM_H
 
+#define EEPROM_PAGE     64  // bytes per page write (24LC515)
+#define EEPROM_WRITE_MS 5   // write cycle, at most
+#define EEPROM_POLL_MS  10  // ACK polling gives up after this
+
+// EEPROM_FILL progress: bytes written so far, of the total
+typedef void (*eeprom_progress_t)(uint32_t u32_done, uint32_t u32_total);
+
+/**
+ * One EEPROM transaction queued on I2C1 (see queueI2C1)
+ * Must stay put, as must its buffer, until EEPROM_ASYNC_DONE
+ **/
+struct eeprom_async {
+  I2C_XFER xfer;
+  I2C_STEP aSteps[6];
+  uint8_t au8_head[3];  // control byte, address high, address low
+  uint8_t u8_readCtl;   // control byte, read
+};
+
 // INIT
 void CONFIG_EEPROM(void);
 uint16_t EEPROM_GET_ADDR(uint16_t u16_addr);
 
+// WRITE CYCLE
+uint8_t EEPROM_WRITE_DONE(void);
+uint8_t EEPROM_WAIT_WRITE(void);
+
 // READ
 uint8_t EEPROM_READ_CURRENT(void);
 uint8_t EEPROM_READ_SPECIFIC(uint16_t u16_addr);
-char* EEPROM_READSTR_UNTILNULL(uint16_t u16_addr);
-char* EEPROM_READSTR_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr);
+uint8_t EEPROM_READ_BLOCK(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len);
+uint16_t EEPROM_READSTR_UNTILNULL(uint16_t u16_addr, char *sz_buf, uint16_t u16_size);
+uint16_t EEPROM_READSTR_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr, char *sz_buf, uint16_t u16_size);
+char* EEPROM_READSTR_ARENA(struct arena *a, uint16_t u16_addr);
 
 // WRITE
-void EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte);
+uint8_t EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte);
+uint8_t EEPROM_WRITE_PAGE(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
+uint8_t EEPROM_WRITE_BLOCK(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
 void EEPROM_WRITESTR_SPECIFIC(uint16_t u16_addr, const char *data);
 void EEPROM_ZERO_BETWEEN(uint16_t u16_fromAddr, uint16_t u16_toAddr);
+uint8_t EEPROM_FILL(uint16_t u16_fromAddr, uint16_t u16_toAddr, uint8_t u8_value, eeprom_progress_t pfn_progress);
+
+// ASYNC (the shared pins must stay with I2C1 until EEPROM_ASYNC_IDLE)
+uint16_t EEPROM_READ_ASYNC(struct eeprom_async *op, uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len,
+                           void (*pfn_done)(I2C_XFER *), void *p_arg);
+uint8_t EEPROM_WRITE_PAGE_ASYNC(struct eeprom_async *op, uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len,
+                                void (*pfn_done)(I2C_XFER *), void *p_arg);
+uint8_t EEPROM_POLL_ASYNC(struct eeprom_async *op);
+uint8_t EEPROM_ASYNC_DRAIN(void);
+#define EEPROM_ASYNC_DONE(op) ((op)->xfer.u8_status != I2C_XFER_PENDING)
+#define EEPROM_ASYNC_OK(op)   ((op)->xfer.u8_status == I2C_XFER_OK)
+#define EEPROM_ASYNC_IDLE()   isIdleQueueI2C1()
+#define EEPROM_ASYNC_ABORT()  abortQueueI2C1()
 
 
 #endif	/* EEPROM_H */
@@ -0,0 +1,259 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * EEPROM PAGE CACHE
+ **/
+
+#include "eeprom_cache.h"
+
+// a cached page; bytes u8_dirtyFrom up to u8_dirtyTo need writing
+struct cache_page {
+  uint16_t u16_addr;      // first address, page aligned
+  uint16_t u16_used;      // u16_stamp when last used, for LRU
+  uint8_t u8_valid;
+  uint8_t u8_dirtyFrom;
+  uint8_t u8_dirtyTo;     // 0: clean
+  uint8_t au8_data[EEPROM_PAGE];
+};
+
+// FILE SPECIFIC FUNCTIONS
+static struct cache_page* CACHE_FIND(uint16_t u16_addr);
+static struct cache_page* CACHE_LOAD(uint16_t u16_addr);
+static uint8_t CACHE_WRITE_DIRTY(struct cache_page *page);
+static uint8_t CACHE_WRITE_BACK(struct cache_page *page);
+
+// FILE SPECIFIC VARIABLES
+static struct cache_page aPages[EEPROM_CACHE_PAGES];
+static uint16_t u16_stamp;
+
+/**
+ * @return the cached page holding an address, or NULL
+ */
+static struct cache_page* CACHE_FIND(uint16_t u16_addr) {
+  uint8_t u8_i;
+  
+  u16_addr -= u16_addr % EEPROM_PAGE;
+  for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES; u8_i++) {
+    if (aPages[u8_i].u8_valid && aPages[u8_i].u16_addr == u16_addr) {
+      return &aPages[u8_i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Brings the page holding an address in, if it isn't, over a free
+ * page or else the least recently used one, and marks it used
+ * @return the page; NULL, if the chip stopped answering (a dirty page
+ *         that couldn't be written back stays cached, dirty)
+ */
+static struct cache_page* CACHE_LOAD(uint16_t u16_addr) {
+  struct cache_page *page = CACHE_FIND(u16_addr);
+  uint8_t u8_i;
+  
+  if (!page) {
+    // a free page, or the one unused the longest
+    page = &aPages[0];
+    for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES && page->u8_valid; u8_i++) {
+      if (!aPages[u8_i].u8_valid ||
+          (uint16_t) (u16_stamp - aPages[u8_i].u16_used) > (uint16_t) (u16_stamp - page->u16_used)) {
+        page = &aPages[u8_i];
+      }
+    }
+    if (page->u8_valid && !CACHE_WRITE_BACK(page)) return NULL;
+    
+    // fill (a flushed page may still be programming)
+    page->u8_valid = 0;
+    page->u16_addr = u16_addr - u16_addr % EEPROM_PAGE;
+    EEPROM_WAIT_WRITE();
+    if (!EEPROM_READ_BLOCK(page->u16_addr, page->au8_data, EEPROM_PAGE)) return NULL;
+    page->u8_valid = 1;
+    page->u8_dirtyFrom = 0;
+    page->u8_dirtyTo = 0;
+  }
+  
+  page->u16_used = ++u16_stamp;
+  return page;
+}
+
+/**
+ * Starts writing a dirty page's dirty bytes out, and marks it clean
+ * once they have all gone
+ * @return 1, if written; 0, if the chip stopped answering (still dirty)
+ */
+static uint8_t CACHE_WRITE_DIRTY(struct cache_page *page) {
+  uint8_t u8_len = page->u8_dirtyTo - page->u8_dirtyFrom;
+  
+  if (EEPROM_WRITE_PAGE(page->u16_addr + page->u8_dirtyFrom,
+      &page->au8_data[page->u8_dirtyFrom], u8_len) != u8_len) return 0;
+  page->u8_dirtyTo = 0;
+  return 1;
+}
+
+/**
+ * Writes a page's dirty bytes out, waiting for the write cycle
+ * @return 1, if clean now; 0, if the chip stopped answering
+ */
+static uint8_t CACHE_WRITE_BACK(struct cache_page *page) {
+  if (page->u8_dirtyTo == 0) return 1;
+  if (!CACHE_WRITE_DIRTY(page)) return 0;
+  return EEPROM_WAIT_WRITE();
+}
+
+/**
+ * Reads one byte, through the cache
+ * @param pu8_byte gets it
+ * @return 1, if read; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_CACHE_READ(uint16_t u16_addr, uint8_t *pu8_byte) {
+  return EEPROM_CACHE_READ_BLOCK(u16_addr, pu8_byte, 1);
+}
+
+/**
+ * Reads bytes, through the cache, a page at a time
+ * @param u16_addr first address
+ * @param pu8_buf where to put them
+ * @param u16_len number of bytes
+ * @return 1, if all read; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_CACHE_READ_BLOCK(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len) {
+  struct cache_page *page;
+  uint8_t u8_off, u8_n;
+  
+  while (u16_len > 0) {
+    page = CACHE_LOAD(u16_addr);
+    if (!page) return 0;
+    u8_off = u16_addr % EEPROM_PAGE;
+    u8_n = EEPROM_PAGE - u8_off;
+    if (u16_len < u8_n) u8_n = u16_len;
+    memcpy(pu8_buf, &page->au8_data[u8_off], u8_n);
+    u16_addr += u8_n;
+    pu8_buf += u8_n;
+    u16_len -= u8_n;
+  }
+  return 1;
+}
+
+/**
+ * Writes one byte into the cache (see EEPROM_CACHE_WRITE_BLOCK)
+ */
+uint8_t EEPROM_CACHE_WRITE(uint16_t u16_addr, uint8_t u8_byte) {
+  return EEPROM_CACHE_WRITE_BLOCK(u16_addr, &u8_byte, 1);
+}
+
+/**
+ * Writes bytes into the cache, a page at a time, marking them dirty
+ * Nothing goes to the chip but the write back of an evicted page
+ * @param u16_addr first address
+ * @param pu8_data bytes to write
+ * @param u16_len number of bytes
+ * @return 1, if all written; 0, if a page couldn't be brought in
+ *         (the ones before it are written)
+ */
+uint8_t EEPROM_CACHE_WRITE_BLOCK(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  struct cache_page *page;
+  uint8_t u8_off, u8_n;
+  
+  while (u16_len > 0) {
+    page = CACHE_LOAD(u16_addr);
+    if (!page) return 0;
+    u8_off = u16_addr % EEPROM_PAGE;
+    u8_n = EEPROM_PAGE - u8_off;
+    if (u16_len < u8_n) u8_n = u16_len;
+    memcpy(&page->au8_data[u8_off], pu8_data, u8_n);
+    
+    // grow the dirty span
+    if (page->u8_dirtyTo == 0) {
+      page->u8_dirtyFrom = u8_off;
+      page->u8_dirtyTo = u8_off + u8_n;
+    } else {
+      if (u8_off < page->u8_dirtyFrom) page->u8_dirtyFrom = u8_off;
+      if (u8_off + u8_n > page->u8_dirtyTo) page->u8_dirtyTo = u8_off + u8_n;
+    }
+    u16_addr += u8_n;
+    pu8_data += u8_n;
+    u16_len -= u8_n;
+  }
+  return 1;
+}
+
+/**
+ * Copies bytes written to the chip around the cache into any cached
+ * page they fall on, so a later flush doesn't put the old ones back
+ * Uses no bus; pages not cached are left out
+ */
+void EEPROM_CACHE_SYNC(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  struct cache_page *page;
+  uint8_t u8_off, u8_n;
+  
+  while (u16_len > 0) {
+    page = CACHE_FIND(u16_addr);
+    u8_off = u16_addr % EEPROM_PAGE;
+    u8_n = EEPROM_PAGE - u8_off;
+    if (u16_len < u8_n) u8_n = u16_len;
+    if (page) memcpy(&page->au8_data[u8_off], pu8_data, u8_n);
+    u16_addr += u8_n;
+    pu8_data += u8_n;
+    u16_len -= u8_n;
+  }
+}
+
+/**
+ * @return number of dirty pages
+ */
+uint8_t EEPROM_CACHE_DIRTY(void) {
+  uint8_t u8_i, u8_n = 0;
+  
+  for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES; u8_i++) {
+    if (aPages[u8_i].u8_valid && aPages[u8_i].u8_dirtyTo) u8_n++;
+  }
+  return u8_n;
+}
+
+/**
+ * Starts writing one dirty page out, and marks it clean
+ * Doesn't wait for the write cycle: see EEPROM_WRITE_DONE
+ * @return 1, if a page was written; 0, if none was dirty, or the chip
+ *         stopped answering (the page stays dirty)
+ */
+uint8_t EEPROM_CACHE_FLUSH_PAGE(void) {
+  struct cache_page *page;
+  uint8_t u8_i;
+  
+  for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES; u8_i++) {
+    page = &aPages[u8_i];
+    if (page->u8_valid && page->u8_dirtyTo) return CACHE_WRITE_DIRTY(page);
+  }
+  return 0;
+}
+
+/**
+ * Writes every dirty page out, waiting out each write cycle
+ * @return 1, if all written; 0, if the chip stopped answering
+ */
+uint8_t EEPROM_CACHE_FLUSH(void) {
+  while (EEPROM_CACHE_FLUSH_PAGE()) {
+    if (!EEPROM_WAIT_WRITE()) return 0;
+  }
+  return EEPROM_CACHE_DIRTY() == 0;
+}
@@ -0,0 +1,61 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * EEPROM PAGE CACHE
+ * 
+ * Write-back cache of EEPROM_CACHE_PAGES whole pages in front of the
+ * eeprom.c primitives. Reads come from RAM once a page is in; writes
+ * only change RAM and mark the bytes dirty, so a byte rewritten many
+ * times costs one page program when it is flushed. The least recently
+ * used page makes room for a new one (written back first if dirty).
+ * 
+ * Nothing reaches the chip until a flush or an eviction: flush at safe
+ * points (game over, a scene change, idle). A miss, an eviction or a
+ * flush uses the bus, so the caller must have it on the EEPROM. A
+ * page is only marked clean once all its dirty bytes are written, and
+ * only cached once it has been read whole.
+ * Writes made around the cache go through EEPROM_CACHE_SYNC.
+ **/
+
+#include "eeprom.h"
+
+#ifndef EEPROM_CACHE_H
+#define	EEPROM_CACHE_H
+
+#define EEPROM_CACHE_PAGES 4   // 64 bytes of RAM each
+
+// READ
+uint8_t EEPROM_CACHE_READ(uint16_t u16_addr, uint8_t *pu8_byte);
+uint8_t EEPROM_CACHE_READ_BLOCK(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len);
+
+// WRITE
+uint8_t EEPROM_CACHE_WRITE(uint16_t u16_addr, uint8_t u8_byte);
+uint8_t EEPROM_CACHE_WRITE_BLOCK(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
+void EEPROM_CACHE_SYNC(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
+
+// FLUSH
+uint8_t EEPROM_CACHE_DIRTY(void);
+uint8_t EEPROM_CACHE_FLUSH_PAGE(void);
+uint8_t EEPROM_CACHE_FLUSH(void);
+
+#endif	/* EEPROM_CACHE_H */
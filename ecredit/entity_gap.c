@@ -29,15 +29,36 @@
 void entity_gap_init(struct entity_gap *entity, int8_t x, int8_t y) {
   entity->x = x;
   entity->y = y;
+  entity->px = x;
+  entity->h = ENTITY_GAP_HEIGHT;
 }
 
-void entity_gap_init_randy(struct entity_gap *entity, int8_t x) {
+void entity_gap_init_randy(struct entity_gap *entity, int8_t x, uint32_t *pu32_seed) {
+  entity_gap_init_randy_tuned(entity, x, ENTITY_GAP_RANGE, ENTITY_GAP_HEIGHT, pu32_seed);
+}
+
+/**
+ * Random gap with the y range and opening height passed in (for tuning)
+ */
+void entity_gap_init_randy_tuned(struct entity_gap *entity, int8_t x, uint8_t u8_range, int8_t h, uint32_t *pu32_seed) {
   entity->x = x;
+  entity->px = x;
+  entity->h = h;
   
-  int r = rand() % 31;
+  int r = entity_gap_rand(pu32_seed) % u8_range;
   entity->y = r;
 }
 
+/**
+ * Same LCG as the classic C library rand(), but with the state
+ * passed in, so a seed gives the same course on the PIC and the host
+ */
+int entity_gap_rand(uint32_t *pu32_seed) {
+  *pu32_seed = *pu32_seed * 1103515245UL + 12345;
+  return (*pu32_seed >> 16) & 0x7FFF;
+}
+
 void entity_gap_update(struct entity_gap *entity) {
+  entity->px = entity->x;
   entity->x -= 2;
 }
\ No newline at end of file
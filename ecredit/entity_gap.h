@@ -30,15 +30,20 @@
 #include "pic24_all.h"
 #include <stdlib.h>
 
-#define ENTITY_GAP_WIDTH 5;
-#define ENTITY_GAP_HEIGHT 15;
+#define ENTITY_GAP_WIDTH 6
+#define ENTITY_GAP_HEIGHT 15
+#define ENTITY_GAP_RANGE 31  // y is 0 .. RANGE-1
 
 struct entity_gap {
   int8_t x, y;
+  int8_t px;  // x before the last update
+  int8_t h;   // height of the opening
 };
 
 void entity_gap_init(struct entity_gap *entity, int8_t x, int8_t y);
-void entity_gap_init_randy(struct entity_gap *entity, int8_t x);
+void entity_gap_init_randy(struct entity_gap *entity, int8_t x, uint32_t *pu32_seed);
+void entity_gap_init_randy_tuned(struct entity_gap *entity, int8_t x, uint8_t u8_range, int8_t h, uint32_t *pu32_seed);
+int entity_gap_rand(uint32_t *pu32_seed);
 void entity_gap_update(struct entity_gap *entity);
 
 #endif	/* GAP_H */
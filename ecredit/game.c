@@ -0,0 +1,240 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Game Rules
+ * 
+ * Everything that decides how a game plays out, with no hardware
+ * access, so the same rules run on the PIC and in the host simulator.
+ * One call to game_step() is one frame.
+ **/
+
+#include "game.h"
+#include "collision.h"
+#include "nokia_5110.h"
+#include "profile.h"
+
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+const struct game_tuning GAME_TUNING_DEFAULT = {
+  PDOT_GRAVITY,       // f_gravity
+  PDOT_FLAP,          // f_flap
+  ENTITY_GAP_HEIGHT,  // i8_gapHeight
+  20,                 // u8_gapSpacing
+  ENTITY_GAP_RANGE    // u8_gapRange
+};
+
+// FILE SPECIFIC FUNCTIONS
+static void draw_gap(struct entity_gap *entity);
+static uint8_t check_for_collision(struct game *g);
+
+/**
+ * Starts a new game
+ * @param g game
+ * @param u16_seed seed for the gap randomizer
+ */
+void game_init(struct game *g, uint16_t u16_seed) {
+  game_init_tuned(g, u16_seed, &GAME_TUNING_DEFAULT);
+}
+
+/**
+ * Starts a new game with different physics/course knobs
+ * @param g game
+ * @param u16_seed seed for the gap randomizer
+ * @param tuning knobs, must outlive the game
+ */
+void game_init_tuned(struct game *g, uint16_t u16_seed, const struct game_tuning *tuning) {
+  g->tuning = tuning;
+  
+  // store and init the player dot
+  player_dot_init(&g->pDot, 6, 20, 0, 0, 2);
+  
+  g->u32_seed = u16_seed;
+  g->u16_frame = 0;
+  g->u8_release_timer = 35;
+  g->u8_count = 0;
+  g->u8_idx = 0;
+  g->u8_ingap = GAME_NO_GAP;
+  g->u8_score = 0;
+  g->u8_running = 1;
+}
+
+/**
+ * Advances the game by one frame
+ * @param g game
+ * @param u8_pressed 1, if the button is down this frame
+ * @return 1, if still running; 0, if game over
+ */
+uint8_t game_step(struct game *g, uint8_t u8_pressed) {
+  uint8_t u8_i, u8_hit;
+  
+  if (!g->u8_running) return 0;
+  PROFILE_START();
+  
+  // update gaps
+  for (u8_i = 0; u8_i < g->u8_count; u8_i++) {
+    entity_gap_update(&g->gaps[u8_i]);
+    
+    // if out, open for overwrite
+    if (g->gaps[u8_i].x < -6) g->u8_idx = u8_i;
+  }
+  
+  // if not full, make gaps
+  if (g->u8_count < 4) {
+    
+    // check if time to release new gap
+    if (g->u8_release_timer >= g->tuning->u8_gapSpacing) {
+      // set gap position
+      entity_gap_init_randy_tuned(&g->gaps[g->u8_idx], 84,
+              g->tuning->u8_gapRange, g->tuning->i8_gapHeight, &g->u32_seed);
+      
+      // clear the timer
+      g->u8_release_timer = 0;
+      
+      // increment
+      g->u8_count = max(g->u8_idx, g->u8_count);
+      g->u8_idx++;
+    } else {
+      // increment time
+      g->u8_release_timer++;
+    }
+    
+  }
+  
+  PROFILE_LAP(PROFILE_PHYSICS);
+  
+  // check for collision with gap or floor
+  u8_hit = check_for_collision(g) ||
+           (g->pDot.y >= 43 && g->pDot.dy == 0);
+  PROFILE_LAP(PROFILE_COLLISION);
+  if (u8_hit) {
+    // GAME OVER!
+    g->u8_running = 0;
+    return 0;
+  }
+  
+  // update player's physics
+  player_dot_update_tuned(&g->pDot, u8_pressed,
+          g->tuning->f_gravity, g->tuning->f_flap);
+  g->u16_frame++;
+  PROFILE_LAP(PROFILE_PHYSICS);
+  
+  return 1;
+}
+
+/**
+ * Draws the current frame into video memory
+ */
+void game_draw(struct game *g) {
+  uint8_t u8_i;
+  char score[6];
+  
+  // clear and draw floor
+  PROFILE_START();
+  NOK_CLEAR();
+  NOK_LINE(0, 47, 83, 47, 1);
+  PROFILE_LAP(PROFILE_CLEAR);
+  
+  // draw gaps
+  for (u8_i = 0; u8_i < g->u8_count; u8_i++) {
+    draw_gap(&g->gaps[u8_i]);
+  }
+  PROFILE_LAP(PROFILE_GAPS);
+  
+  // draw the player dot
+  NOK_CIRCLE(g->pDot.x, g->pDot.y, g->pDot.radius, 1, 1);
+  PROFILE_LAP(PROFILE_PLAYER);
+  
+  // convert score to string and show
+  sprintf(score, "%d", g->u8_score);
+  NOK_MOVE_CURSOR(42-5, 0);
+  NOK_STR(score);
+  PROFILE_LAP(PROFILE_TEXT);
+}
+
+/**
+ * Draws the popped (white) dot where the player crashed
+ */
+void game_draw_crash(struct game *g) {
+  NOK_CIRCLE(g->pDot.x, g->pDot.y, g->pDot.radius, 1, 0);
+  NOK_CIRCLE(g->pDot.x, g->pDot.y, g->pDot.radius, 0, 1);
+}
+
+/**
+ * Draws gap entity
+ */
+static void draw_gap(struct entity_gap *entity) {
+  // store the x, y, height of gap
+  int8_t x, y, h;
+  x = entity->x;
+  y = entity->y;
+  h = entity->h;
+  
+  // check if in range to draw
+  if (x > -6 && x < 84) {
+    // draw full rectangle (BLACK)
+    NOK_RECT(max(min(x, 84), 0), 0, max(min(x+6, 84), 0), 48  , 1, 1);
+    
+    // draw gap (WHITE)
+    NOK_RECT(max(min(x, 84), 0), y, max(min(x+6, 84), 0), y+h, 1, 0);
+  }
+}
+
+/**
+ * Checks for collision of player_dot with any entity_gaps
+ * Sweeps the last frame of movement, so fast dots/gaps can't tunnel
+ * Scores a point each time the player leaves a gap
+ * @param g game
+ * @return 1, if collision; otherwise, 0
+ */
+static uint8_t check_for_collision(struct game *g) {
+  uint8_t u8_i, u8_result;
+  
+  // loop through all gaps
+  for (u8_i = 0; u8_i < g->u8_count; u8_i++) {
+    // sweep player against current gap
+    u8_result = collision_swept_gap(&g->pDot, &g->gaps[u8_i]);
+    
+    if (u8_result == COLLISION_HIT) {
+      // COLLISION!
+      return 1;
+    } else if (u8_result == COLLISION_IN_GAP) {
+      // note in gap
+      g->u8_ingap = u8_i;
+    } else {
+      // exited gap safely
+      if (g->u8_ingap == u8_i) {
+        // up the score
+        g->u8_score++;
+        g->u8_ingap = GAME_NO_GAP;
+      } 
+    }
+  }
+  
+  // no collisions
+  return 0;
+}
@@ -0,0 +1,71 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Game Rules
+ **/
+
+#ifndef GAME_H
+#define	GAME_H
+
+#include "pic24_all.h"
+#include "pDot.h"
+#include "entity_gap.h"
+
+#define GAME_MAX_GAPS 5
+#define GAME_NO_GAP   99
+
+// knobs for balancing; the PIC always plays GAME_TUNING_DEFAULT
+struct game_tuning {
+  float f_gravity;        // added to dy each frame
+  float f_flap;           // dy after a press
+  int8_t i8_gapHeight;    // opening of each gap
+  uint8_t u8_gapSpacing;  // frames between gaps
+  uint8_t u8_gapRange;    // gap y is 0 .. range-1
+};
+
+extern const struct game_tuning GAME_TUNING_DEFAULT;
+
+struct game {
+  const struct game_tuning *tuning;
+  struct player_dot pDot;
+  struct entity_gap gaps[GAME_MAX_GAPS];
+  uint32_t u32_seed;         // gap randomizer state
+  uint16_t u16_frame;        // frames played
+  uint8_t u8_release_timer;  // times the release of gaps
+  uint8_t u8_count;          // number of gaps
+  uint8_t u8_idx;            // next open index
+  uint8_t u8_ingap;          // gap the player is inside of
+  uint8_t u8_score;
+  uint8_t u8_running;
+};
+
+// RULES
+void game_init(struct game *g, uint16_t u16_seed);
+void game_init_tuned(struct game *g, uint16_t u16_seed, const struct game_tuning *tuning);
+uint8_t game_step(struct game *g, uint8_t u8_pressed);
+
+// VIDEO MEMORY
+void game_draw(struct game *g);
+void game_draw_crash(struct game *g);
+
+#endif	/* GAME_H */
@@ -0,0 +1,194 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Ghost of the Best Run
+ **/
+
+#include "ghost.h"
+#include "eeprom.h"
+
+/**
+ * Starts an empty trajectory
+ */
+void ghost_record_start(struct ghost_rec *r) {
+  r->u16_frames = 0;
+}
+
+/**
+ * Adds the y drawn this frame
+ * @param r trajectory
+ * @param i8_y player y, in px
+ */
+void ghost_record(struct ghost_rec *r, int8_t i8_y) {
+  int8_t i8_d;
+  uint16_t u16_n;
+  
+  if (r->u16_frames == GHOST_MAX_FRAMES) return;
+  
+  // first frame is absolute
+  if (r->u16_frames == 0) {
+    r->i8_y0 = i8_y;
+    r->i8_y = i8_y;
+    r->u16_frames = 1;
+    return;
+  }
+  
+  // others are deltas, clamped to a nibble
+  i8_d = i8_y - r->i8_y;
+  if (i8_d > 7) i8_d = 7;
+  if (i8_d < -8) i8_d = -8;
+  r->i8_y += i8_d;
+  
+  u16_n = r->u16_frames - 1;
+  if (u16_n & 1) {
+    r->au8_nibbles[u16_n >> 1] |= i8_d & 0x0F;
+  } else {
+    r->au8_nibbles[u16_n >> 1] = (i8_d & 0x0F) << 4;
+  }
+  r->u16_frames++;
+}
+
+/**
+ * Header bytes
+ * @param r trajectory
+ * @param pu8_buf GHOST_HEADER bytes
+ */
+void ghost_header(const struct ghost_rec *r, uint8_t *pu8_buf) {
+  pu8_buf[0] = r->u16_frames >> 8;
+  pu8_buf[1] = r->u16_frames & 0xFF;
+  pu8_buf[2] = r->i8_y0;
+}
+
+/**
+ * Stores a trajectory in EEPROM
+ * I2C1 has to be on
+ * @param r trajectory
+ * @param u16_addr where to put it (GHOST_ADDR)
+ */
+void ghost_save(const struct ghost_rec *r, uint16_t u16_addr) {
+  uint8_t au8_header[GHOST_HEADER];
+  static const uint8_t u8_erased = 0xFF;
+  
+  // mark it empty while the nibbles are written
+  ghost_header(r, au8_header);
+  EEPROM_WRITE_BLOCK(u16_addr, &u8_erased, 1);
+  EEPROM_WRITE_BLOCK(u16_addr + 2, &au8_header[2], 1);
+  EEPROM_WRITE_BLOCK(u16_addr + GHOST_HEADER, r->au8_nibbles, r->u16_frames / 2);
+  
+  EEPROM_WRITE_BLOCK(u16_addr + 1, &au8_header[1], 1);
+  EEPROM_WRITE_BLOCK(u16_addr, &au8_header[0], 1);
+}
+
+/**
+ * Reads the header and fills the buffer
+ * I2C1 has to be on
+ * @param p playback state
+ * @param u16_addr where the trajectory is (GHOST_ADDR)
+ * @return 1, if there is one; 0, if not, or the chip stopped answering
+ */
+uint8_t ghost_play_start(struct ghost_play *p, uint16_t u16_addr) {
+  uint8_t au8_header[GHOST_HEADER];
+  
+  if (!EEPROM_READ_BLOCK(u16_addr, au8_header, GHOST_HEADER)) {
+    p->u16_frames = p->u16_frame = 0;
+    p->u16_addr = p->u16_end = u16_addr + GHOST_HEADER;
+    p->u8_count = 0;
+    return 0;
+  }
+  p->u16_frames = ((uint16_t) au8_header[0] << 8) | au8_header[1];
+  p->i8_y = (int8_t) au8_header[2];
+  p->u16_frame = 0;
+  p->u16_addr = u16_addr + GHOST_HEADER;
+  p->u16_end = p->u16_addr + p->u16_frames / 2;
+  p->u8_head = 0;
+  p->u8_count = 0;
+  
+  // erased or never written
+  if (p->u16_frames == 0 || p->u16_frames > GHOST_MAX_FRAMES) {
+    p->u16_frames = 0;
+    return 0;
+  }
+  
+  ghost_play_fill(p);
+  return 1;
+}
+
+/**
+ * The ghost's y this frame
+ * @param p playback state
+ * @param pi8_y gets the y
+ * @return 1, if there is one; 0, if the ghost's run is over
+ */
+uint8_t ghost_play_next(struct ghost_play *p, int8_t *pi8_y) {
+  uint8_t u8_byte;
+  int8_t i8_d;
+  
+  if (p->u16_frame >= p->u16_frames) return 0;
+  
+  // frames after the first move by a nibble
+  if (p->u16_frame > 0) {
+    if (p->u8_count == 0) return 0;  // starved, skip drawing
+    
+    u8_byte = p->au8_buf[p->u8_head];
+    if (p->u16_frame & 1) {
+      i8_d = (int8_t) u8_byte >> 4;
+    } else {
+      i8_d = (int8_t) (u8_byte << 4) >> 4;
+      p->u8_head = (p->u8_head + 1) % GHOST_BUF;
+      p->u8_count--;
+    }
+    p->i8_y += i8_d;
+  }
+  
+  p->u16_frame++;
+  *pi8_y = p->i8_y;
+  return 1;
+}
+
+/**
+ * @return 1, if the buffer is half empty and there's more to read
+ */
+uint8_t ghost_play_needs_fill(const struct ghost_play *p) {
+  return p->u8_count <= GHOST_BUF / 2 && p->u16_addr < p->u16_end;
+}
+
+/**
+ * Tops up the buffer with one sequential read
+ * A read that fails leaves the buffer as it was, for the next fill
+ * I2C1 has to be on
+ */
+void ghost_play_fill(struct ghost_play *p) {
+  uint8_t u8_tail, u8_n;
+  
+  while (p->u8_count < GHOST_BUF && p->u16_addr < p->u16_end) {
+    // as much as fits before the ring wraps
+    u8_tail = (p->u8_head + p->u8_count) % GHOST_BUF;
+    u8_n = GHOST_BUF - p->u8_count;
+    if (u8_n > GHOST_BUF - u8_tail) u8_n = GHOST_BUF - u8_tail;
+    if (u8_n > p->u16_end - p->u16_addr) u8_n = p->u16_end - p->u16_addr;
+    
+    if (!EEPROM_READ_BLOCK(p->u16_addr, &p->au8_buf[u8_tail], u8_n)) return;
+    p->u16_addr += u8_n;
+    p->u8_count += u8_n;
+  }
+}
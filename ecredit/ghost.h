@@ -0,0 +1,76 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Ghost of the Best Run
+ * 
+ * The player's y, one signed nibble a frame: the change since the frame
+ * before, clamped to -8..7 (a bigger jump catches up over the next
+ * frames). Kept in EEPROM right after where the high score was:
+ *   0x1338  frames (2 bytes, big endian)
+ *   0x133A  first y
+ *   0x133B  nibbles, high nibble first
+ * Playback streams it through a small read-ahead buffer, refilled with
+ * one sequential read when it runs low, so no frame waits on the EEPROM.
+ **/
+
+#ifndef GHOST_H
+#define	GHOST_H
+
+#include "pic24_all.h"
+
+#define GHOST_ADDR       0x1338  // next to the old high score (0x1337)
+#define GHOST_HEADER     3
+#define GHOST_MAX_FRAMES 4000
+#define GHOST_BUF        32      // read-ahead bytes (64 frames)
+
+struct ghost_rec {
+  uint16_t u16_frames;
+  int8_t i8_y0;
+  int8_t i8_y;            // y as the nibbles so far put it
+  uint8_t au8_nibbles[GHOST_MAX_FRAMES / 2];
+};
+
+struct ghost_play {
+  uint16_t u16_frames;
+  uint16_t u16_frame;     // next frame to play
+  uint16_t u16_addr;      // next EEPROM byte to fetch
+  uint16_t u16_end;       // past the last byte
+  int8_t i8_y;
+  uint8_t au8_buf[GHOST_BUF];
+  uint8_t u8_head;        // next byte in au8_buf
+  uint8_t u8_count;       // bytes in au8_buf
+};
+
+// RECORDING
+void ghost_record_start(struct ghost_rec *r);
+void ghost_record(struct ghost_rec *r, int8_t i8_y);
+void ghost_header(const struct ghost_rec *r, uint8_t *pu8_buf);
+void ghost_save(const struct ghost_rec *r, uint16_t u16_addr);
+
+// PLAYBACK
+uint8_t ghost_play_start(struct ghost_play *p, uint16_t u16_addr);
+uint8_t ghost_play_next(struct ghost_play *p, int8_t *pi8_y);
+uint8_t ghost_play_needs_fill(const struct ghost_play *p);
+void ghost_play_fill(struct ghost_play *p);
+
+#endif	/* GHOST_H */
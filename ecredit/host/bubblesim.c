@@ -0,0 +1,167 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * HEADLESS SIMULATOR
+ * 
+ * Runs the real game rules (game.c) on the host, as fast as it can.
+ * 
+ * usage: bubblesim [-s seed] [-n games] [-i script] [-p percent]
+ *                  [-m frames] [-f] [-v]
+ *   -s seed     gap seed of the first game (default 20, like the PIC)
+ *   -n games    games to play, seeds count up from -s (default 1)
+ *   -i script   input script, one char per frame: '1' pressed,
+ *               '0' released, anything else skipped; '-' is stdin
+ *   -p percent  without a script, press at random this % of frames
+ *   -m frames   give up on a game after this many frames
+ *   -f          draw every frame to stdout (implies -v)
+ *   -v          one line per game
+ **/
+
+#include <getopt.h>
+#include <time.h>
+#include "pic24_all.h"
+#include "game.h"
+#include "nokia_5110.h"
+
+#define SIM_MAX_FRAMES 20000
+
+// FILE SPECIFIC FUNCTIONS
+static char* read_script(const char *path, uint32_t *pu32_len);
+static void print_frame(const uint8_t *pu8_lcd);
+
+/**
+ * Reads an input script into a '0'/'1' array
+ */
+static char* read_script(const char *path, uint32_t *pu32_len) {
+  FILE *f;
+  char *buf;
+  uint32_t u32_cap, u32_len;
+  int c;
+  
+  f = strcmp(path, "-") ? fopen(path, "r") : stdin;
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  
+  u32_cap = 1024;
+  u32_len = 0;
+  buf = malloc(u32_cap);
+  while ((c = fgetc(f)) != EOF) {
+    if (c != '0' && c != '1') continue;
+    if (u32_len == u32_cap) {
+      u32_cap *= 2;
+      buf = realloc(buf, u32_cap);
+    }
+    buf[u32_len++] = c;
+  }
+  if (f != stdin) fclose(f);
+  
+  *pu32_len = u32_len;
+  return buf;
+}
+
+static void print_frame(const uint8_t *pu8_lcd) {
+  hal_print_frame(pu8_lcd);
+}
+
+int main(int argc, char **argv) {
+  uint32_t u32_seed = 20, u32_games = 1, u32_maxFrames = SIM_MAX_FRAMES;
+  uint32_t u32_scriptLen = 0, u32_percent = 0, u32_rng;
+  uint8_t u8_draw = 0, u8_verbose = 0, u8_pressed;
+  char *script = NULL;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "s:n:i:p:m:fv")) != -1) {
+    switch (opt) {
+      case 's': u32_seed = strtoul(optarg, NULL, 0); break;
+      case 'n': u32_games = strtoul(optarg, NULL, 0); break;
+      case 'i': script = read_script(optarg, &u32_scriptLen); break;
+      case 'p': u32_percent = strtoul(optarg, NULL, 0); break;
+      case 'm': u32_maxFrames = strtoul(optarg, NULL, 0); break;
+      case 'f': u8_draw = 1; u8_verbose = 1; break;
+      case 'v': u8_verbose = 1; break;
+      default:
+        fprintf(stderr, "usage: %s [-s seed] [-n games] [-i script] "
+                        "[-p percent] [-m frames] [-f] [-v]\n", argv[0]);
+        return 2;
+    }
+  }
+  
+  if (u8_draw) hal_set_frame_sink(print_frame);
+  
+  struct game game;
+  uint32_t u32_g, u32_f;
+  uint64_t u64_frames = 0, u64_score = 0;
+  uint8_t u8_best = 0;
+  clock_t start = clock();
+  
+  for (u32_g = 0; u32_g < u32_games; u32_g++) {
+    game_init(&game, u32_seed + u32_g);
+    u32_rng = u32_seed + u32_g;
+    
+    for (u32_f = 0; u32_f < u32_maxFrames && game.u8_running; u32_f++) {
+      // next input
+      if (script) {
+        u8_pressed = (u32_f < u32_scriptLen) && script[u32_f] == '1';
+      } else {
+        u8_pressed = (entity_gap_rand(&u32_rng) % 100) < u32_percent;
+      }
+      hal_pb_set(u8_pressed);
+      
+      if (u8_draw) {
+        game_draw(&game);
+        NOK_UPDATE();
+      }
+      
+      if (!game_step(&game, u8_pressed)) {
+        if (u8_draw) {
+          game_draw_crash(&game);
+          NOK_UPDATE();
+        }
+      }
+      
+      // frame period, on the simulated clock
+      DELAY_MS(80);
+    }
+    
+    if (u8_verbose) {
+      printf("seed %u score %u frames %u%s\n", (unsigned) (u32_seed + u32_g),
+             game.u8_score, game.u16_frame, game.u8_running ? " (alive)" : "");
+    }
+    
+    u64_frames += game.u16_frame;
+    u64_score += game.u8_score;
+    if (game.u8_score > u8_best) u8_best = game.u8_score;
+  }
+  
+  double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+  printf("games %u  frames %llu  mean score %.2f  best %u  "
+         "%.0f games/s  %.0f frames/s\n",
+         (unsigned) u32_games, (unsigned long long) u64_frames,
+         (double) u64_score / u32_games, u8_best,
+         secs > 0 ? u32_games / secs : 0, secs > 0 ? u64_frames / secs : 0);
+  
+  free(script);
+  return 0;
+}
@@ -0,0 +1,429 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * EEPROM BENCHMARK
+ * 
+ * Runs the real eeprom.c (its string reads into arena.c arenas too),
+ * eeprom_cache.c and store.c over a model of the 24LC515 on the I2C1
+ * bus (lc515.c), with the chip's memory in a file, and reports what
+ * each job costs on the bus: transactions, bytes, write cycles,
+ * control bytes NAKed while the chip was busy, the time the bus was
+ * busy and the whole (simulated) time, write cycles included.
+ * 
+ * usage: eepbench [-f file] [-k kHz] [-n ops] [-s seed]
+ *   -f file  the chip's memory, kept between runs (default lc515.bin);
+ *            the jobs overwrite 0x7E10 to 0x8210 and the record store
+ *   -k kHz   bus clock (default 400)
+ *   -n ops   record store puts (default 1000)
+ *   -s seed  PRNG seed (default 1)
+ * 
+ * Exits with 1 if anything reads back wrong.
+ **/
+
+#include <getopt.h>
+#include "pic24_all.h"
+#include "eeprom_cache.h"
+#include "store.h"
+#include "lc515.h"
+
+#define BENCH_ADDR  0x7E10  // not page aligned, and across 0x8000
+#define BENCH_BYTES 1024
+
+// FILE SPECIFIC FUNCTIONS
+static uint32_t xorshift(uint32_t *pu32_s);
+static void fill_progress(uint32_t u32_done, uint32_t u32_total);
+static void job_start(void);
+static void job_report(const char *sz_name);
+static uint8_t cache_put(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len);
+static uint8_t cache_on_chip(uint16_t u16_addr, uint16_t u16_len);
+static uint8_t cache_job(uint32_t *pu32_rng);
+static uint8_t strings_job(void);
+
+// FILE SPECIFIC VARIABLES
+static uint32_t u32_jobStart;
+static uint8_t au8_data[BENCH_BYTES];
+static uint8_t au8_back[BENCH_BYTES];
+static uint32_t u32_fillCalls, u32_fillDone;
+
+/**
+ * Small, fast PRNG for the data
+ */
+static uint32_t xorshift(uint32_t *pu32_s) {
+  uint32_t x = *pu32_s;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *pu32_s = x;
+}
+
+/**
+ * EEPROM_FILL's progress: must only ever go up, to the total
+ */
+static void fill_progress(uint32_t u32_done, uint32_t u32_total) {
+  if (u32_done <= u32_fillDone || u32_done > u32_total) {
+    fprintf(stderr, "fill progress %lu of %lu after %lu\n", (unsigned long) u32_done,
+            (unsigned long) u32_total, (unsigned long) u32_fillDone);
+    exit(1);
+  }
+  u32_fillCalls++;
+  u32_fillDone = u32_done;
+}
+
+static void job_start(void) {
+  lc515_reset_stats();
+  u32_jobStart = micros();
+}
+
+/**
+ * One line for the job just run
+ */
+static void job_report(const char *sz_name) {
+  const struct lc515_stats *st = lc515_stats();
+  
+  printf("%-14s %8lu %8lu %7lu %6lu %9.2f %9.2f\n", sz_name,
+         (unsigned long) st->u32_transactions, (unsigned long) st->u32_bytes,
+         (unsigned long) st->u32_programs, (unsigned long) st->u32_busyNaks,
+         st->u64_busNs / 1e6, (micros() - u32_jobStart) / 1e3);
+}
+
+/**
+ * Writes bytes through the cache, and into the model (au8_data)
+ * @return 1, if the cache took them
+ */
+static uint8_t cache_put(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  memcpy(&au8_data[u16_addr - BENCH_ADDR], pu8_data, u16_len);
+  return EEPROM_CACHE_WRITE_BLOCK(u16_addr, pu8_data, u16_len);
+}
+
+/**
+ * @return 1, if the chip holds the model (from u16_addr on)
+ */
+static uint8_t cache_on_chip(uint16_t u16_addr, uint16_t u16_len) {
+  return EEPROM_READ_BLOCK(u16_addr, au8_back, u16_len) &&
+         memcmp(au8_back, &au8_data[u16_addr - BENCH_ADDR], u16_len) == 0;
+}
+
+/**
+ * The page cache over the KB at BENCH_ADDR, against a model of it:
+ * dirty spans merged into one write, LRU eviction with write back,
+ * random writes (across pages, overlapping), reads and flushes, then
+ * a chip that stops answering, which must leave the pages dirty, and
+ * not cache what it couldn't read
+ * @return 1, if it all read back right
+ */
+static uint8_t cache_job(uint32_t *pu32_rng) {
+  uint16_t u16_page = (BENCH_ADDR + EEPROM_PAGE - 1) & ~(EEPROM_PAGE - 1);  // first whole one
+  uint16_t u16_addr, u16_len;
+  uint32_t u32_programs, u32_op;
+  uint8_t au8_bytes[100];
+  uint8_t u8_i, u8_byte;
+  
+  if (!EEPROM_READ_BLOCK(BENCH_ADDR, au8_data, BENCH_BYTES)) return 0;
+  
+  // two bytes far apart in a page go out as one write of the span
+  u32_programs = lc515_stats()->u32_programs;
+  u8_byte = 0x11;
+  cache_put(u16_page + 2, &u8_byte, 1);
+  u8_byte = 0x22;
+  cache_put(u16_page + 40, &u8_byte, 1);
+  if (!EEPROM_CACHE_FLUSH() || lc515_stats()->u32_programs != u32_programs + 1 ||
+      !cache_on_chip(u16_page, EEPROM_PAGE)) {
+    fprintf(stderr, "cache: dirty span not merged\n");
+    return 0;
+  }
+  
+  // fill the cache with dirty pages, use the first again: a fifth
+  // page evicts the second, written back, and only it
+  for (u8_i = 0; u8_i <= EEPROM_CACHE_PAGES; u8_i++) {
+    if (u8_i == EEPROM_CACHE_PAGES) EEPROM_CACHE_READ(u16_page, &u8_byte);
+    u16_addr = u16_page + u8_i * EEPROM_PAGE + 5;
+    u8_byte = ~au8_data[u16_addr - BENCH_ADDR];
+    cache_put(u16_addr, &u8_byte, 1);
+  }
+  for (u8_i = 0; u8_i <= EEPROM_CACHE_PAGES; u8_i++) {
+    u16_addr = u16_page + u8_i * EEPROM_PAGE + 5;
+    if (EEPROM_READ_SPECIFIC(u16_addr) == au8_data[u16_addr - BENCH_ADDR] ? u8_i != 1 : u8_i == 1) {
+      fprintf(stderr, "cache: page %u evicted wrong\n", u8_i);
+      return 0;
+    }
+  }
+  if (EEPROM_CACHE_DIRTY() != EEPROM_CACHE_PAGES) {
+    fprintf(stderr, "cache: %u pages dirty\n", EEPROM_CACHE_DIRTY());
+    return 0;
+  }
+  
+  // at random: a write (up to 100 bytes), a read, or one page flushed
+  for (u32_op = 0; u32_op < 4000; u32_op++) {
+    u16_len = xorshift(pu32_rng) % sizeof(au8_bytes) + 1;
+    u16_addr = BENCH_ADDR + xorshift(pu32_rng) % (BENCH_BYTES - u16_len + 1);
+    switch (xorshift(pu32_rng) % 8) {
+      case 0:
+        if (EEPROM_CACHE_FLUSH_PAGE()) EEPROM_WAIT_WRITE();
+        break;
+      case 1:
+      case 2:
+        if (!EEPROM_CACHE_READ_BLOCK(u16_addr, au8_bytes, u16_len) ||
+            memcmp(au8_bytes, &au8_data[u16_addr - BENCH_ADDR], u16_len)) {
+          fprintf(stderr, "cache: 0x%04X read wrong\n", u16_addr);
+          return 0;
+        }
+        break;
+      default:
+        for (u8_i = 0; u8_i < u16_len; u8_i++) au8_bytes[u8_i] = xorshift(pu32_rng);
+        cache_put(u16_addr, au8_bytes, u16_len);
+        break;
+    }
+  }
+  if (!EEPROM_CACHE_FLUSH() || EEPROM_CACHE_DIRTY() || !cache_on_chip(BENCH_ADDR, BENCH_BYTES)) {
+    fprintf(stderr, "cache: flushed wrong\n");
+    return 0;
+  }
+  
+  // a page that can't be read isn't cached
+  for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES; u8_i++) {
+    EEPROM_CACHE_READ(u16_page + u8_i * EEPROM_PAGE, &u8_byte);
+  }
+  u16_addr = u16_page + EEPROM_CACHE_PAGES * EEPROM_PAGE;
+  lc515_unplug(1);
+  u8_byte = EEPROM_CACHE_READ_BLOCK(u16_addr, au8_bytes, EEPROM_PAGE);
+  lc515_unplug(0);
+  if (u8_byte || !EEPROM_CACHE_READ_BLOCK(u16_addr, au8_bytes, EEPROM_PAGE) ||
+      memcmp(au8_bytes, &au8_data[u16_addr - BENCH_ADDR], EEPROM_PAGE)) {
+    fprintf(stderr, "cache: failed read cached\n");
+    return 0;
+  }
+  
+  // nor is a dirty page marked clean when its write fails: in a
+  // flush, or in making room
+  for (u8_i = 0; u8_i < EEPROM_CACHE_PAGES; u8_i++) {
+    u16_addr = u16_page + u8_i * EEPROM_PAGE + 9;
+    u8_byte = ~au8_data[u16_addr - BENCH_ADDR];
+    cache_put(u16_addr, &u8_byte, 1);
+  }
+  lc515_unplug(1);
+  u8_byte = EEPROM_CACHE_FLUSH();
+  u8_byte |= EEPROM_CACHE_WRITE(u16_page + EEPROM_CACHE_PAGES * EEPROM_PAGE, 0);
+  lc515_unplug(0);
+  if (u8_byte || EEPROM_CACHE_DIRTY() != EEPROM_CACHE_PAGES ||
+      !EEPROM_CACHE_FLUSH() || !cache_on_chip(BENCH_ADDR, BENCH_BYTES)) {
+    fprintf(stderr, "cache: failed write back marked clean\n");
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * The string reads over the KB at BENCH_ADDR: a string across two
+ * chunk ends ended by a NUL, one a chunk long ended by an erased 0xFF,
+ * reads cut short by the buffer (nothing past it touched), reads
+ * between two addresses, and arena reads down to 1 byte free, then
+ * none
+ * @return 1, if all came back right
+ */
+static uint8_t strings_job(void) {
+  static const char sz_text[] = "The quick brown fox jumps over the lazy dog";
+  static const uint8_t u8_nul = 0x00, u8_erased = 0xFF;
+  uint16_t u16_len = sizeof(sz_text) - 1;
+  uint16_t au16_arena[24];  // word aligned
+  char *sz_arena = (char *) au16_arena;
+  char sz_buf[64];
+  struct arena a;
+  char *sz;
+  
+  if (!EEPROM_WRITE_BLOCK(BENCH_ADDR, (const uint8_t *) sz_text, u16_len) ||
+      !EEPROM_WRITE_BLOCK(BENCH_ADDR + u16_len, &u8_nul, 1) ||
+      !EEPROM_WRITE_BLOCK(BENCH_ADDR + 64, (const uint8_t *) sz_text, 16) ||
+      !EEPROM_WRITE_BLOCK(BENCH_ADDR + 64 + 16, &u8_erased, 1)) {
+    fprintf(stderr, "strings: not written\n");
+    return 0;
+  }
+  
+  // to the end
+  if (EEPROM_READSTR_UNTILNULL(BENCH_ADDR, sz_buf, sizeof(sz_buf)) != u16_len ||
+      strcmp(sz_buf, sz_text)) {
+    fprintf(stderr, "strings: read to NUL wrong\n");
+    return 0;
+  }
+  if (EEPROM_READSTR_UNTILNULL(BENCH_ADDR + 64, sz_buf, sizeof(sz_buf)) != 16 ||
+      strncmp(sz_buf, sz_text, 16) || sz_buf[16]) {
+    fprintf(stderr, "strings: read to 0xFF wrong\n");
+    return 0;
+  }
+  
+  // to the end of the buffer, and no further
+  memset(sz_buf, '#', sizeof(sz_buf));
+  if (EEPROM_READSTR_UNTILNULL(BENCH_ADDR, sz_buf, 20) != 19 ||
+      strncmp(sz_buf, sz_text, 19) || sz_buf[19] || sz_buf[20] != '#' ||
+      EEPROM_READSTR_UNTILNULL(BENCH_ADDR, &sz_buf[30], 1) != 0 || sz_buf[30] || sz_buf[31] != '#') {
+    fprintf(stderr, "strings: read cut short wrong\n");
+    return 0;
+  }
+  
+  // between two addresses: all of it, what fits, and none
+  memset(sz_buf, '#', sizeof(sz_buf));
+  if (EEPROM_READSTR_BETWEEN(BENCH_ADDR + 4, BENCH_ADDR + 24, sz_buf, sizeof(sz_buf)) != 20 ||
+      strncmp(sz_buf, sz_text + 4, 20) || sz_buf[20] ||
+      EEPROM_READSTR_BETWEEN(BENCH_ADDR + 8, BENCH_ADDR + 24, &sz_buf[32], 8) != 7 ||
+      strncmp(&sz_buf[32], sz_text + 8, 7) || sz_buf[39] || sz_buf[40] != '#' ||
+      EEPROM_READSTR_BETWEEN(BENCH_ADDR + 24, BENCH_ADDR + 4, sz_buf, sizeof(sz_buf)) != 0 ||
+      sz_buf[0]) {
+    fprintf(stderr, "strings: read between wrong\n");
+    return 0;
+  }
+  
+  // an arena with room for the string and 1 byte: then an empty
+  // string, then none
+  memset(au16_arena, '#', sizeof(au16_arena));
+  arena_init(&a, au16_arena, u16_len + 2);
+  sz = EEPROM_READSTR_ARENA(&a, BENCH_ADDR);
+  if (sz != sz_arena || strcmp(sz, sz_text) || arena_mark(&a) != u16_len + 1 ||
+      (sz = EEPROM_READSTR_ARENA(&a, BENCH_ADDR)) != sz_arena + u16_len + 1 || sz[0] ||
+      arena_mark(&a) != u16_len + 2 || EEPROM_READSTR_ARENA(&a, BENCH_ADDR) != NULL ||
+      strcmp(sz_arena, sz_text) || sz_arena[u16_len + 2] != '#') {
+    fprintf(stderr, "strings: arena read wrong\n");
+    return 0;
+  }
+  
+  // ... and one the string doesn't fit in
+  arena_init(&a, au16_arena, 10);
+  sz = EEPROM_READSTR_ARENA(&a, BENCH_ADDR + 4);
+  if (sz != sz_arena || strncmp(sz, sz_text + 4, 9) || sz[9] || arena_mark(&a) != 10) {
+    fprintf(stderr, "strings: arena read cut short wrong\n");
+    return 0;
+  }
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  const char *path = "lc515.bin";
+  uint32_t u32_ops = 1000, u32_rng = 1, u32_op;
+  uint16_t u16_kHz = 400, u16_i;
+  uint8_t au8_model[STORE_KEYS][STORE_MAX_VALUE + 1];  // length, then value
+  uint8_t au8_value[STORE_MAX_VALUE];
+  uint8_t u8_key, u8_len, u8_before, u8_after;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "f:k:n:s:")) != -1) {
+    switch (opt) {
+      case 'f': path = optarg; break;
+      case 'k': u16_kHz = strtoul(optarg, NULL, 0); break;
+      case 'n': u32_ops = strtoul(optarg, NULL, 0); break;
+      case 's': u32_rng = strtoul(optarg, NULL, 0); break;
+      default:
+        fprintf(stderr, "usage: %s [-f file] [-k kHz] [-n ops] [-s seed]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (u32_rng == 0) u32_rng = 1;
+  if (!lc515_open(path)) {
+    perror(path);
+    return 2;
+  }
+  lc515_bus_khz(u16_kHz);
+  for (u16_i = 0; u16_i < BENCH_BYTES; u16_i++) au8_data[u16_i] = xorshift(&u32_rng);
+  
+  printf("%u kHz bus\n", u16_kHz);
+  printf("%-14s %8s %8s %7s %6s %9s %9s\n", "job", "xfers", "bytes", "cycles", "naks", "bus ms", "ms");
+  
+  // a block a page at a time, read back sequentially and byte by byte
+  job_start();
+  EEPROM_WRITE_BLOCK(BENCH_ADDR, au8_data, BENCH_BYTES);
+  job_report("write 1 KB");
+  
+  job_start();
+  EEPROM_READ_BLOCK(BENCH_ADDR, au8_back, BENCH_BYTES);
+  job_report("read 1 KB");
+  if (memcmp(au8_back, au8_data, BENCH_BYTES)) {
+    fprintf(stderr, "block read back wrong\n");
+    return 1;
+  }
+  
+  job_start();
+  for (u16_i = 0; u16_i < BENCH_BYTES; u16_i++) au8_back[u16_i] = EEPROM_READ_SPECIFIC(BENCH_ADDR + u16_i);
+  job_report("read 1 KB x1");
+  if (memcmp(au8_back, au8_data, BENCH_BYTES)) {
+    fprintf(stderr, "bytes read back wrong\n");
+    return 1;
+  }
+  
+  // a part page, 15 pages and a part page: none of the bytes around
+  u8_before = EEPROM_READ_SPECIFIC(BENCH_ADDR - 1);
+  u8_after = EEPROM_READ_SPECIFIC(BENCH_ADDR + BENCH_BYTES);
+  job_start();
+  EEPROM_FILL(BENCH_ADDR, BENCH_ADDR + BENCH_BYTES, 0x5A, fill_progress);
+  job_report("fill 1 KB");
+  EEPROM_READ_BLOCK(BENCH_ADDR, au8_back, BENCH_BYTES);
+  for (u16_i = 0; u16_i < BENCH_BYTES && au8_back[u16_i] == 0x5A; u16_i++);
+  if (u16_i < BENCH_BYTES || u32_fillDone != BENCH_BYTES || u32_fillCalls != 17 ||
+      EEPROM_READ_SPECIFIC(BENCH_ADDR - 1) != u8_before ||
+      EEPROM_READ_SPECIFIC(BENCH_ADDR + BENCH_BYTES) != u8_after) {
+    fprintf(stderr, "fill wrong\n");
+    return 1;
+  }
+  
+  // the page cache, over the same KB
+  job_start();
+  if (!cache_job(&u32_rng)) return 1;
+  job_report("cache");
+  
+  // strings, into buffers and arenas
+  job_start();
+  if (!strings_job()) return 1;
+  job_report("strings");
+  
+  // the record store: boot, then random puts, checked after a reboot
+  job_start();
+  store_init();
+  job_report("store boot");
+  for (u8_key = 0; u8_key < STORE_KEYS; u8_key++) {
+    au8_model[u8_key][0] = store_get(u8_key, &au8_model[u8_key][1], STORE_MAX_VALUE);
+  }
+  
+  job_start();
+  for (u32_op = 0; u32_op < u32_ops; u32_op++) {
+    u8_key = xorshift(&u32_rng) % STORE_KEYS;
+    u8_len = xorshift(&u32_rng) % (STORE_MAX_VALUE + 1);
+    for (u16_i = 0; u16_i < u8_len; u16_i++) au8_value[u16_i] = xorshift(&u32_rng);
+    if (store_put(u8_key, au8_value, u8_len)) {
+      au8_model[u8_key][0] = u8_len;
+      memcpy(&au8_model[u8_key][1], au8_value, u8_len);
+    }
+  }
+  job_report("store puts");
+  
+  job_start();
+  store_init();
+  for (u8_key = 0; u8_key < STORE_KEYS; u8_key++) {
+    u8_len = store_get(u8_key, au8_value, STORE_MAX_VALUE);
+    if (u8_len != au8_model[u8_key][0] ||
+        (u8_len != STORE_NONE && memcmp(au8_value, &au8_model[u8_key][1], u8_len))) {
+      fprintf(stderr, "key %u read back wrong\n", u8_key);
+      return 1;
+    }
+  }
+  job_report("store check");
+  
+  lc515_close();
+  printf("ok\n");
+  return 0;
+}
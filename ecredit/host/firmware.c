@@ -0,0 +1,129 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * FIRMWARE ON THE HOST
+ * 
+ * Runs the whole firmware (ecredit.c and its ESOS tasks) against the
+ * host HAL. The ESOS tick is the simulated clock, which moves one tick
+ * per scheduler pass and by every DELAY_MS, so a run is the same every
+ * time: handy for checking task timing without the board.
+ * 
+ * usage: firmware [-t ms] [-i script] [-e image] [-w image] [-f] [-q]
+ *   -t ms      simulated time to run (default 30000)
+ *   -i script  button over time, one char per 10 ms: '1' pressed,
+ *              '0' released, anything else skipped; released after
+ *              the end
+ *   -e image   24LC515 image to boot with
+ *   -w image   save the 24LC515 image at the end
+ *   -f         draw every frame the LCD gets to stdout
+ *   -q         don't echo UART1 (the telemetry lines) to stdout
+ **/
+
+#include <getopt.h>
+#include "pic24_all.h"
+#include "esos.h"
+
+#define FW_SCRIPT_MS 10
+
+// FILE SPECIFIC FUNCTIONS
+static char* read_script(const char *path, uint32_t *pu32_len);
+static void print_frame(const uint8_t *pu8_lcd);
+
+/**
+ * Reads a button script into a '0'/'1' array
+ */
+static char* read_script(const char *path, uint32_t *pu32_len) {
+  FILE *f;
+  char *buf;
+  uint32_t u32_cap = 1024, u32_len = 0;
+  int c;
+  
+  f = strcmp(path, "-") ? fopen(path, "r") : stdin;
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  
+  buf = malloc(u32_cap);
+  while ((c = fgetc(f)) != EOF) {
+    if (c != '0' && c != '1') continue;
+    if (u32_len == u32_cap) {
+      u32_cap *= 2;
+      buf = realloc(buf, u32_cap);
+    }
+    buf[u32_len++] = c;
+  }
+  if (f != stdin) fclose(f);
+  
+  *pu32_len = u32_len;
+  return buf;
+}
+
+static void print_frame(const uint8_t *pu8_lcd) {
+  printf("t=%lu\n", (unsigned long) hal_millis());
+  hal_print_frame(pu8_lcd);
+}
+
+int main(int argc, char **argv) {
+  uint32_t u32_runMs = 30000, u32_scriptLen = 0, u32_slot;
+  const char *inImage = NULL, *outImage = NULL;
+  char *script = NULL;
+  uint8_t u8_quiet = 0;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "t:i:e:w:fq")) != -1) {
+    switch (opt) {
+      case 't': u32_runMs = strtoul(optarg, NULL, 0); break;
+      case 'i': script = read_script(optarg, &u32_scriptLen); break;
+      case 'e': inImage = optarg; break;
+      case 'w': outImage = optarg; break;
+      case 'f': hal_set_frame_sink(print_frame); break;
+      case 'q': u8_quiet = 1; break;
+      default:
+        fprintf(stderr, "usage: %s [-t ms] [-i script] [-e image] "
+                        "[-w image] [-f] [-q]\n", argv[0]);
+        return 2;
+    }
+  }
+  
+  if (inImage && !hal_eeprom_load(inImage)) {
+    perror(inImage);
+    return 1;
+  }
+  hal_uart_echo(!u8_quiet);
+  
+  esos_Init();
+  while (hal_millis() < u32_runMs) {
+    u32_slot = hal_millis() / FW_SCRIPT_MS;
+    hal_pb_set(u32_slot < u32_scriptLen && script[u32_slot] == '1');
+    esos_RunPass();
+  }
+  
+  if (outImage && !hal_eeprom_save(outImage)) {
+    perror(outImage);
+    return 1;
+  }
+  
+  free(script);
+  return 0;
+}
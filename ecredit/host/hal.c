@@ -0,0 +1,398 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * HOST HAL
+ **/
+
+#include <stdio.h>
+#include "pic24_all.h"
+#include "eeprom.h"
+#include "esos.h"
+
+// PIN/REGISTER STAND-INS
+volatile uint8_t _LATB6, _LATB12, _LATB13, _LATB14;
+uint16_t SPI1CON1, SPI1CON2, SPI1STAT;
+uint16_t U1BRG;
+uint32_t u32_fcy = FCY;
+uint8_t _CNIF, _CNIP, _CNIE;
+SPICON1BITS SPI1CON1bits;
+SPISTATBITS SPI1STATbits;
+I2CCONBITS I2C1CONbits;
+
+// FILE SPECIFIC VARIABLES
+static uint8_t u8_pb;
+static uint64_t u64_clockUs;
+static hal_frame_sink_t frame_sink;
+static uint8_t au8_lcd[HAL_LCD_BYTES];
+static uint16_t u16_lcdPos;
+static uint8_t au8_eeprom[HAL_EEPROM_BYTES];
+static uint8_t u8_eepromErased;
+#ifndef HAL_LC515
+static uint32_t u32_eepromBusy;
+#endif
+static uint32_t u32_cutLeft = HAL_NO_CUT;
+static uint32_t au32_programs[HAL_EEPROM_PAGES];
+static uint8_t u8_uartEcho;
+static uint8_t u8_clockProfile;
+
+// FILE SPECIFIC FUNCTIONS
+static void eeprom_erase_once(void);
+#ifndef HAL_LC515
+static void eeprom_program(uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_n);
+#endif
+
+// BUTTON ///////////////////////////////////////
+void hal_pb_set(uint8_t u8_pressed) {
+  u8_pb = u8_pressed;
+}
+
+uint8_t hal_pb_pressed(void) {
+  return u8_pb;
+}
+
+// CLOCK ////////////////////////////////////////
+/**
+ * ESOS tick stand-ins: the tick is the simulated clock, and each
+ * scheduler pass takes one tick
+ */
+void __esos_hw_InitSystemTick(void) {
+}
+
+uint32_t __esos_hw_GetSystemTickCount(void) {
+  return hal_millis();
+}
+
+void __esos_hw_Idle(void) {
+  hal_delay_ms(ESOS_TICK_MS);
+}
+
+void __esos_hw_RetuneSystemTick(void) {
+}
+
+/**
+ * Clock profile stand-ins: the simulated clock doesn't care, so only
+ * FCY_NOW changes
+ */
+void setClockProfile(uint8_t u8_profile) {
+  u8_clockProfile = u8_profile;
+  u32_fcy = u8_profile == CLOCK_PROFILE_LOW ? CLOCK_LOW_FCY : FCY;
+}
+
+uint8_t getClockProfile(void) {
+  return u8_clockProfile;
+}
+
+uint32_t hal_millis(void) {
+  return u64_clockUs / 1000;
+}
+
+void hal_delay_ms(uint32_t u32_ms) {
+  u64_clockUs += (uint64_t) u32_ms * 1000;
+}
+
+void hal_delay_us(uint32_t u32_us) {
+  u64_clockUs += u32_us;
+}
+
+/**
+ * pic24_time stand-ins, on the simulated clock
+ */
+void configTime32(void) {
+}
+
+void retuneTime32(void) {
+}
+
+uint32_t micros(void) {
+  return u64_clockUs;
+}
+
+uint32_t millis(void) {
+  return u64_clockUs / 1000;
+}
+
+// EEPROM ///////////////////////////////////////
+static void eeprom_erase_once(void) {
+  if (u8_eepromErased) return;
+  memset(au8_eeprom, 0xFF, HAL_EEPROM_BYTES);
+  u8_eepromErased = 1;
+}
+
+/**
+ * Loads an EEPROM image; a short file only fills the start
+ * @return 1, if ok; 0, if the file can't be read
+ */
+uint8_t hal_eeprom_load(const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return 0;
+  
+  eeprom_erase_once();
+  fread(au8_eeprom, 1, HAL_EEPROM_BYTES, f);
+  fclose(f);
+  return 1;
+}
+
+/**
+ * Saves the whole 64 KB image
+ * @return 1, if ok; 0, if the file can't be written
+ */
+uint8_t hal_eeprom_save(const char *path) {
+  FILE *f = fopen(path, "wb");
+  uint8_t u8_ok;
+  if (!f) return 0;
+  
+  eeprom_erase_once();
+  u8_ok = fwrite(au8_eeprom, 1, HAL_EEPROM_BYTES, f) == HAL_EEPROM_BYTES;
+  fclose(f);
+  return u8_ok;
+}
+
+/**
+ * Power fails after another u32_bytes are written: the rest of that
+ * page write and every one after are lost, until called again
+ * @param u32_bytes bytes still to write; HAL_NO_CUT: power is back
+ */
+void hal_eeprom_cut(uint32_t u32_bytes) {
+  u32_cutLeft = u32_bytes;
+}
+
+/**
+ * @return 1, if power has failed (writes are being lost)
+ */
+uint8_t hal_eeprom_is_cut(void) {
+  return u32_cutLeft == 0;
+}
+
+/**
+ * @return write cycles a page has had, for wear
+ */
+uint32_t hal_eeprom_programs(uint16_t u16_page) {
+  return au32_programs[u16_page % HAL_EEPROM_PAGES];
+}
+
+#ifndef HAL_LC515
+/**
+ * One write cycle (within a page), up to a power cut
+ */
+static void eeprom_program(uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_n) {
+  eeprom_erase_once();
+  if (u32_cutLeft == 0) return;
+  au32_programs[u16_addr / EEPROM_PAGE]++;
+  while (u8_n-- && u32_cutLeft) {
+    au8_eeprom[u16_addr++] = *pu8_data++;
+    if (u32_cutLeft != HAL_NO_CUT) u32_cutLeft--;
+  }
+  u32_eepromBusy = deadlineUs(EEPROM_WRITE_MS * 1000L);
+}
+
+/**
+ * eeprom.c stand-ins, straight to the image
+ * Each page write keeps the chip busy for EEPROM_WRITE_MS of
+ * simulated time, the worst case
+ */
+void CONFIG_EEPROM(void) {
+}
+
+uint8_t EEPROM_READ_SPECIFIC(uint16_t u16_addr) {
+  eeprom_erase_once();
+  return au8_eeprom[u16_addr];
+}
+
+uint8_t EEPROM_READ_BLOCK(uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len) {
+  eeprom_erase_once();
+  while (u16_len--) *pu8_buf++ = au8_eeprom[u16_addr++];
+  return 1;
+}
+
+uint8_t EEPROM_WRITE_DONE(void) {
+  return isDeadlinePassed(u32_eepromBusy);
+}
+
+uint8_t EEPROM_WAIT_WRITE(void) {
+  hal_delay_us(usUntil(u32_eepromBusy));
+  return 1;
+}
+
+uint8_t EEPROM_WRITE_SPECIFIC(uint16_t u16_addr, uint8_t u8_byte) {
+  eeprom_program(u16_addr, &u8_byte, 1);
+  return EEPROM_WAIT_WRITE();
+}
+
+uint8_t EEPROM_WRITE_PAGE(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  uint8_t u8_n = EEPROM_PAGE - (u16_addr % EEPROM_PAGE);
+  
+  if (u16_len < u8_n) u8_n = u16_len;
+  eeprom_program(u16_addr, pu8_data, u8_n);
+  return u8_n;
+}
+
+uint8_t EEPROM_WRITE_BLOCK(uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len) {
+  uint8_t u8_n;
+  
+  while (u16_len > 0) {
+    u8_n = EEPROM_WRITE_PAGE(u16_addr, pu8_data, u16_len);
+    EEPROM_WAIT_WRITE();
+    u16_addr += u8_n;
+    pu8_data += u8_n;
+    u16_len -= u8_n;
+  }
+  return 1;
+}
+
+/**
+ * The async ones are done at once, as the PIC library does them
+ * without I2C1_INTERRUPT: the callback is called before they return
+ */
+static void eeprom_async_done(struct eeprom_async *op, uint8_t u8_status,
+                              void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  op->xfer.pfn_done = pfn_done;
+  op->xfer.p_arg = p_arg;
+  op->xfer.u8_status = u8_status;
+  if (pfn_done) pfn_done(&op->xfer);
+}
+
+uint16_t EEPROM_READ_ASYNC(struct eeprom_async *op, uint16_t u16_addr, uint8_t *pu8_buf, uint16_t u16_len,
+                           void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  uint16_t u16_n = 0x8000 - (u16_addr % 0x8000);
+  
+  if (u16_n > u16_len) u16_n = u16_len;
+  EEPROM_READ_BLOCK(u16_addr, pu8_buf, u16_n);
+  eeprom_async_done(op, I2C_XFER_OK, pfn_done, p_arg);
+  return u16_n;
+}
+
+uint8_t EEPROM_WRITE_PAGE_ASYNC(struct eeprom_async *op, uint16_t u16_addr, const uint8_t *pu8_data, uint16_t u16_len,
+                                void (*pfn_done)(I2C_XFER *), void *p_arg) {
+  uint8_t u8_n = EEPROM_PAGE - (u16_addr % EEPROM_PAGE);
+  
+  if (u16_len < u8_n) u8_n = u16_len;
+  // the chip NAKs its address while it programs
+  if (!EEPROM_WRITE_DONE()) {
+    eeprom_async_done(op, I2C_XFER_NAK, pfn_done, p_arg);
+  } else {
+    eeprom_program(u16_addr, pu8_data, u8_n);
+    eeprom_async_done(op, I2C_XFER_OK, pfn_done, p_arg);
+  }
+  return u8_n;
+}
+
+uint8_t EEPROM_POLL_ASYNC(struct eeprom_async *op) {
+  eeprom_async_done(op, EEPROM_WRITE_DONE() ? I2C_XFER_OK : I2C_XFER_NAK, NULL, NULL);
+  return 1;
+}
+
+uint8_t EEPROM_ASYNC_DRAIN(void) {
+  return 1;
+}
+
+// nothing is ever queued
+uint8_t isIdleQueueI2C1(void) {
+  return 1;
+}
+
+void abortQueueI2C1(void) {
+}
+#endif  // HAL_LC515: lc515.c's chip, under the real eeprom.c
+
+// UART1 ////////////////////////////////////////
+void hal_uart_echo(uint8_t u8_on) {
+  u8_uartEcho = u8_on;
+}
+
+void outChar1(uint8_t u8_c) {
+  if (u8_uartEcho) putchar(u8_c);
+}
+
+uint16_t compute_brg(uint32_t u32_fcy, uint16_t u16_brgh, uint32_t u32_baudrate) {
+  return u32_fcy / ((u16_brgh ? 4 : 16) * u32_baudrate) - 1;
+}
+
+// UTIL /////////////////////////////////////////
+void configBasic(const char *sz_helloMsg) {
+  while (*sz_helloMsg) outChar1(*sz_helloMsg++);
+}
+
+void toggleHeartbeat(void) {
+}
+
+// FRAMEBUFFER //////////////////////////////////
+void hal_set_frame_sink(hal_frame_sink_t sink) {
+  frame_sink = sink;
+}
+
+/**
+ * Prints LCD RAM as 48 lines of 84 chars
+ */
+void hal_print_frame(const uint8_t *pu8_lcd) {
+  uint8_t x, y;
+  char line[86];
+  
+  for (y = 0; y < 48; y++) {
+    for (x = 0; x < 84; x++) {
+      line[x] = (pu8_lcd[(y / 8) * 84 + x] >> (y % 8)) & 0x01 ? '#' : '.';
+    }
+    line[84] = '\n';
+    line[85] = '\0';
+    fputs(line, stdout);
+  }
+  fputs("\n", stdout);
+}
+
+/**
+ * SPI1 stand-in: models the PCD8544 in horizontal addressing mode,
+ * data bytes go to the cursor, which wraps after the last bank
+ */
+uint16_t ioMasterSPI1(uint16_t u16_c) {
+  // only data (D/C high) goes to LCD RAM
+  if (!_LATB12) return 0;
+  
+  au8_lcd[u16_lcdPos++] = u16_c & 0xFF;
+  if (u16_lcdPos == HAL_LCD_BYTES) {
+    u16_lcdPos = 0;
+    if (frame_sink) frame_sink(au8_lcd);
+  }
+  return 0;
+}
+
+uint16_t compute_spi_prescale(uint32_t u32_fcy, uint32_t u32_sckHz) {
+  return PRI_PRESCAL_1_1 | SEC_PRESCAL_6_1;
+}
+
+/**
+ * Block write stand-in: a byte at a time, whatever the frame size
+ */
+void writeBlockSPI1(const uint8_t *pu8_data, uint16_t u16_len) {
+  while (u16_len--) ioMasterSPI1(*pu8_data++);
+}
+
+/**
+ * SPI1 TX queue stand-in: sends at once, with D/C (RB12) as tagged
+ */
+void writeQueueSPI1(uint8_t u8_c, uint8_t u8_tag) {
+  _LATB12 = u8_tag;
+  ioMasterSPI1(u8_c);
+}
+
+uint8_t isIdleQueueSPI1(void) {
+  return 1;
+}
@@ -0,0 +1,68 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * HOST HAL
+ * 
+ * The few things the game needs from the board, for a Linux build:
+ * the button, a clock, the EEPROM, UART1 and (optionally) the LCD
+ * contents. Delays don't wait, they only move the simulated clock,
+ * which is also the ESOS system tick.
+ **/
+
+#ifndef HAL_H
+#define	HAL_H
+
+#include <stdint.h>
+
+#define HAL_LCD_BYTES    504    // 84 columns x 6 banks
+#define HAL_EEPROM_BYTES 65536  // 24LC515
+#define HAL_EEPROM_PAGES 1024   // of EEPROM_PAGE bytes
+#define HAL_NO_CUT       0xFFFFFFFF
+
+// frame sink, gets the LCD RAM after every full NOK_UPDATE()
+typedef void (*hal_frame_sink_t)(const uint8_t *pu8_lcd);
+
+// BUTTON
+void hal_pb_set(uint8_t u8_pressed);
+uint8_t hal_pb_pressed(void);
+
+// CLOCK
+uint32_t hal_millis(void);
+void hal_delay_ms(uint32_t u32_ms);
+void hal_delay_us(uint32_t u32_us);
+
+// EEPROM (starts erased, 0xFF)
+uint8_t hal_eeprom_load(const char *path);
+uint8_t hal_eeprom_save(const char *path);
+void hal_eeprom_cut(uint32_t u32_bytes);
+uint8_t hal_eeprom_is_cut(void);
+uint32_t hal_eeprom_programs(uint16_t u16_page);
+
+// UART1 (off by default)
+void hal_uart_echo(uint8_t u8_on);
+
+// FRAMEBUFFER
+void hal_set_frame_sink(hal_frame_sink_t sink);
+void hal_print_frame(const uint8_t *pu8_lcd);
+
+#endif	/* HAL_H */
@@ -0,0 +1,344 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * 24LC515 ON A SIMULATED I2C1 BUS
+ **/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "pic24_all.h"
+#include "lc515.h"
+
+// where the chip is in a transaction
+#define LC_IDLE    0  // after a stop (or before any start)
+#define LC_CONTROL 1  // a start: the control byte is next
+#define LC_ADDR_HI 2
+#define LC_ADDR_LO 3
+#define LC_WRITE   4  // data bytes into the page latch
+#define LC_READ    5  // data bytes out, until the master NAKs
+#define LC_IGNORE  6  // not for us, NAKed or done: wait for a start
+
+// FILE SPECIFIC FUNCTIONS
+static void bus_time(uint8_t u8_bits);
+static uint8_t is_busy(void);
+static void bus_start(void);
+static void bus_stop(void);
+static uint8_t bus_put(uint8_t u8_val);
+static uint8_t bus_get(uint8_t u8_ack2Send);
+
+// FILE SPECIFIC VARIABLES
+static int i_fd = -1;
+static uint8_t *pu8_mem;
+static uint16_t u16_busKHz = 400;
+static uint64_t u64_carryNs;
+static struct lc515_stats stats;
+static uint8_t u8_state = LC_IDLE;
+static uint16_t u16_block;           // 0x0000 or 0x8000, from the control byte
+static uint16_t u16_ptr;             // address within the block
+static uint8_t au8_latch[LC515_PAGE];
+static uint64_t u64_latched;         // bit per latch byte written
+static uint16_t u16_latchPage;
+static uint32_t u32_busyUntil;
+static uint8_t u8_unplugged;         // NAK everything, as if not there
+
+/**
+ * Opens (or makes, erased) the chip's 64 KB file and maps it
+ * @return 1, if ok; 0, if the file can't be opened or mapped
+ */
+uint8_t lc515_open(const char *path) {
+  struct stat st;
+  off_t size;
+  
+  lc515_close();
+  i_fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (i_fd < 0 || fstat(i_fd, &st) < 0) return 0;
+  size = st.st_size < LC515_BYTES ? st.st_size : LC515_BYTES;
+  if (ftruncate(i_fd, LC515_BYTES) < 0) return 0;
+  pu8_mem = mmap(NULL, LC515_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, i_fd, 0);
+  if (pu8_mem == MAP_FAILED) {
+    pu8_mem = NULL;
+    return 0;
+  }
+  // a new (or short) file is erased
+  memset(pu8_mem + size, 0xFF, LC515_BYTES - size);
+  
+  u8_state = LC_IDLE;
+  u32_busyUntil = micros();
+  lc515_reset_stats();
+  return 1;
+}
+
+/**
+ * Writes the image back and unmaps it
+ */
+void lc515_close(void) {
+  if (pu8_mem) {
+    msync(pu8_mem, LC515_BYTES, MS_SYNC);
+    munmap(pu8_mem, LC515_BYTES);
+    pu8_mem = NULL;
+  }
+  if (i_fd >= 0) {
+    close(i_fd);
+    i_fd = -1;
+  }
+}
+
+/**
+ * Sets the bus clock (configI2C1 does too)
+ */
+void lc515_bus_khz(uint16_t u16_kHz) {
+  if (u16_kHz) u16_busKHz = u16_kHz;
+}
+
+const struct lc515_stats* lc515_stats(void) {
+  return &stats;
+}
+
+void lc515_reset_stats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+/**
+ * Takes the chip off the bus, or puts it back: while it is off every
+ * control byte is NAKed, so each transaction fails (after eeprom.c's
+ * retries), as with a dead or missing chip
+ */
+void lc515_unplug(uint8_t u8_off) {
+  u8_unplugged = u8_off;
+}
+
+/**
+ * Moves the simulated clock on by some bit times
+ * (a byte and its ACK is 9; a start or a stop, about 1)
+ */
+static void bus_time(uint8_t u8_bits) {
+  uint64_t u64_ns = (uint64_t) u8_bits * 1000000 / u16_busKHz;
+  
+  stats.u64_busNs += u64_ns;
+  u64_carryNs += u64_ns;
+  hal_delay_us(u64_carryNs / 1000);
+  u64_carryNs %= 1000;
+}
+
+/**
+ * @return 1, during a write cycle
+ */
+static uint8_t is_busy(void) {
+  return (int32_t) (micros() - u32_busyUntil) < 0;
+}
+
+/**
+ * A start or a repeated start: a write not yet stopped is dropped
+ */
+static void bus_start(void) {
+  bus_time(1);
+  stats.u32_transactions++;
+  u64_latched = 0;
+  u8_state = LC_CONTROL;
+}
+
+/**
+ * A stop: after data bytes, the page latch is programmed
+ */
+static void bus_stop(void) {
+  uint8_t u8_i;
+  
+  bus_time(1);
+  if (u8_state == LC_WRITE && u64_latched) {
+    for (u8_i = 0; u8_i < LC515_PAGE; u8_i++) {
+      if (u64_latched & (1ULL << u8_i)) pu8_mem[u16_latchPage + u8_i] = au8_latch[u8_i];
+    }
+    u64_latched = 0;
+    stats.u32_programs++;
+    u32_busyUntil = micros() + LC515_WRITE_US;
+  }
+  u8_state = LC_IDLE;
+}
+
+/**
+ * A byte from the master
+ * @return I2C_ACK or I2C_NAK, from the chip
+ */
+static uint8_t bus_put(uint8_t u8_val) {
+  bus_time(9);
+  stats.u32_bytes++;
+  switch (u8_state) {
+    case LC_CONTROL:
+      // 1010, block, A1 A0 (chip select), R/W
+      if ((u8_val & 0xF6) != (LC515_ADDR & 0xF6) || u8_unplugged) break;
+      if (is_busy()) {
+        stats.u32_busyNaks++;
+        break;
+      }
+      u16_block = (u8_val & 0x08) ? 0x8000 : 0x0000;
+      u8_state = (u8_val & 0x01) ? LC_READ : LC_ADDR_HI;
+      return I2C_ACK;
+    case LC_ADDR_HI:
+      u16_ptr = (u8_val & 0x7F) << 8;  // the top bit doesn't matter
+      u8_state = LC_ADDR_LO;
+      return I2C_ACK;
+    case LC_ADDR_LO:
+      u16_ptr |= u8_val;
+      u8_state = LC_WRITE;
+      return I2C_ACK;
+    case LC_WRITE:
+      // into the latch, rolling over within the page
+      u16_latchPage = u16_block | (u16_ptr & ~(LC515_PAGE - 1));
+      au8_latch[u16_ptr % LC515_PAGE] = u8_val;
+      u64_latched |= 1ULL << (u16_ptr % LC515_PAGE);
+      u16_ptr = (u16_ptr & ~(LC515_PAGE - 1)) | ((u16_ptr + 1) % LC515_PAGE);
+      return I2C_ACK;
+    default:
+      break;
+  }
+  u8_state = LC_IGNORE;
+  return I2C_NAK;
+}
+
+/**
+ * A byte to the master, which answers with u8_ack2Send
+ * @return the byte; 0xFF (the pull-up) if the chip isn't sending
+ */
+static uint8_t bus_get(uint8_t u8_ack2Send) {
+  uint8_t u8_val;
+  
+  bus_time(9);
+  stats.u32_bytes++;
+  if (u8_state != LC_READ) return 0xFF;
+  // sequential: wraps within the block
+  u8_val = pu8_mem[u16_block | u16_ptr];
+  u16_ptr = (u16_ptr + 1) & 0x7FFF;
+  if (u8_ack2Send == I2C_NAK) u8_state = LC_IGNORE;
+  return u8_val;
+}
+
+/**
+ * pic24_i2c stand-ins, on the model (the bus never sticks)
+ */
+void configI2C1(uint16_t u16_FkHZ) {
+  lc515_bus_khz(u16_FkHZ);
+}
+
+void startI2C1(void) {
+  bus_start();
+}
+
+void rstartI2C1(void) {
+  bus_start();
+}
+
+void stopI2C1(void) {
+  bus_stop();
+}
+
+void putI2C1(uint8_t u8_val) {
+  if (bus_put(u8_val) != I2C_ACK) {
+    // the PIC would reportError and reset
+    fprintf(stderr, "lc515: NAK to putI2C1(0x%02X)\n", u8_val);
+    exit(1);
+  }
+}
+
+uint8_t putNoAckCheckI2C1(uint8_t u8_val) {
+  return bus_put(u8_val);
+}
+
+uint8_t getI2C1(uint8_t u8_ack2Send) {
+  return bus_get(u8_ack2Send);
+}
+
+uint8_t tryStartI2C1(void) {
+  bus_start();
+  return I2C_ACK;
+}
+
+uint8_t tryRstartI2C1(void) {
+  bus_start();
+  return I2C_ACK;
+}
+
+uint8_t tryStopI2C1(void) {
+  bus_stop();
+  return I2C_ACK;
+}
+
+uint8_t tryPutI2C1(uint8_t u8_val) {
+  return bus_put(u8_val);
+}
+
+uint8_t tryGetI2C1(uint8_t u8_ack2Send, uint8_t *pu8_byte) {
+  *pu8_byte = bus_get(u8_ack2Send);
+  return I2C_ACK;
+}
+
+void recoverI2C1(void) {
+  bus_time(9);
+  bus_stop();
+}
+
+/**
+ * Runs a transaction at once, as the PIC library does without
+ * I2C1_INTERRUPT
+ */
+uint8_t queueI2C1(I2C_XFER *pst_xfer) {
+  const I2C_STEP *pst_step;
+  uint8_t u8_step;
+  uint16_t u16_i;
+  uint8_t u8_ack = I2C_ACK;
+  
+  for (u8_step = 0; u8_step < pst_xfer->u8_steps && u8_ack == I2C_ACK; u8_step++) {
+    pst_step = &pst_xfer->pst_steps[u8_step];
+    switch (pst_step->u8_op) {
+      case I2C_OP_START:
+        bus_start();
+        break;
+      case I2C_OP_WRITE:
+        for (u16_i = 0; u16_i < pst_step->u16_len && u8_ack == I2C_ACK; u16_i++) {
+          u8_ack = bus_put(pst_step->pu8_data[u16_i]);
+        }
+        break;
+      case I2C_OP_READ:
+        for (u16_i = 0; u16_i < pst_step->u16_len; u16_i++) {
+          pst_step->pu8_data[u16_i] = bus_get(u16_i + 1 == pst_step->u16_len ? I2C_NAK : I2C_ACK);
+        }
+        break;
+      default:
+        bus_stop();
+        break;
+    }
+  }
+  if (u8_ack == I2C_NAK) bus_stop();
+  pst_xfer->u8_status = u8_ack == I2C_ACK ? I2C_XFER_OK : I2C_XFER_NAK;
+  if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+  return 1;
+}
+
+uint8_t isIdleQueueI2C1(void) {
+  return 1;
+}
+
+void abortQueueI2C1(void) {
+  recoverI2C1();
+}
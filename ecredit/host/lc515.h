@@ -0,0 +1,66 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * 24LC515 ON A SIMULATED I2C1 BUS
+ * 
+ * Stands in for the I2C1 functions of the PIC library, so the real
+ * eeprom.c (and everything on it) runs on the host against a model of
+ * the chip: the control byte with its block select bit (0x08), a
+ * 16-bit address, page writes that roll over within their 64 bytes,
+ * sequential reads that wrap within their 32 KB block, and a write
+ * cycle during which the chip NAKs its control byte.
+ * 
+ * The memory is a 64 KB file, mapped with mmap, so it persists from
+ * one run to the next. Every bus event moves the simulated clock
+ * (hal.c) by its time at the bus speed, and is counted, so changes to
+ * the storage code can be benchmarked. Build with HAL_LC515 to take
+ * hal.c's own EEPROM stand-ins out.
+ **/
+
+#ifndef LC515_H
+#define	LC515_H
+
+#include <stdint.h>
+
+#define LC515_BYTES    65536
+#define LC515_PAGE     64
+#define LC515_ADDR     0xA2   // control byte, block 0, write
+#define LC515_WRITE_US 5000   // write cycle (the datasheet's worst case)
+
+// counts since lc515_open or lc515_reset_stats
+struct lc515_stats {
+  uint32_t u32_transactions;  // starts, repeated ones included
+  uint32_t u32_bytes;         // on the bus, both ways, control and address bytes included
+  uint32_t u32_busyNaks;      // control bytes NAKed during a write cycle
+  uint32_t u32_programs;      // write cycles
+  uint64_t u64_busNs;         // time the bus was busy
+};
+
+uint8_t lc515_open(const char *path);
+void lc515_close(void);
+void lc515_bus_khz(uint16_t u16_kHz);
+const struct lc515_stats* lc515_stats(void);
+void lc515_reset_stats(void);
+void lc515_unplug(uint8_t u8_off);
+
+#endif	/* LC515_H */
@@ -0,0 +1,197 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * HOST STAND-IN FOR pic24_all.h
+ * 
+ * Found ahead of lib/include by the host Makefile. Covers only what
+ * the game sources and ecredit.c use; anything touching hardware goes
+ * to hal.c.
+ **/
+
+#ifndef PIC24_ALL_HOST_H
+#define	PIC24_ALL_HOST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hal.h"
+
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+// DELAYS (no-ops, only move the clock)
+#define DELAY_MS(ms) hal_delay_ms(ms)
+#define DELAY_US(us) hal_delay_us(us)
+#define doHeartbeat()
+
+// CLOCK (setClockProfile only changes FCY_NOW)
+#define FCY                  60000000L
+#define CLOCK_PROFILE_FULL   0
+#define CLOCK_PROFILE_LOW    1
+#define CLOCK_LOW_FCY        3685000L
+#define FCY_NOW              (u32_fcy)
+
+extern uint32_t u32_fcy;
+void setClockProfile(uint8_t u8_profile);
+uint8_t getClockProfile(void);
+
+// UTIL
+#define HELLO_MSG "host build\n"
+void configBasic(const char *sz_helloMsg);
+void toggleHeartbeat(void);
+
+// PORTS
+extern volatile uint8_t _LATB6, _LATB12, _LATB13, _LATB14;
+#define CONFIG_RB6_AS_DIG_OUTPUT()
+#define CONFIG_RB12_AS_DIG_OUTPUT()
+#define CONFIG_RB13_AS_DIG_OUTPUT()
+#define CONFIG_RB14_AS_DIG_OUTPUT()
+
+// BUTTON (RB3, pulled up: low when pressed)
+#define _RB3 (!hal_pb_pressed())
+#define CONFIG_RB3_AS_DIG_INPUT()
+#define ENABLE_RB3_PULLUP()
+#define ENABLE_RB3_CN_INTERRUPT()
+
+// INTERRUPTS (flags only; no ISR is ever called)
+#define _ISR
+extern uint8_t _CNIF, _CNIP, _CNIE;
+
+// SPI (values from pic24_spi.h)
+#define SPI_MODE8_ON         0x0000
+#define SPI_CKE_ON           0x0100
+#define CLK_POL_ACTIVE_HIGH  0x0000
+#define MASTER_ENABLE_ON     0x0020
+#define SEC_PRESCAL_6_1      0x0008
+#define PRI_PRESCAL_1_1      0x0003
+#define SEC_PRESCAL_MASK     (~0x001c)
+#define PRI_PRESCAL_MASK     (~0x0003)
+#define SPI_ENH_BUFF_ENABLE  0x0001
+#define SPI_SISEL_TX_COMPLETE 0x0014
+#define SPI_TX_CMD           0
+#define SPI_TX_DATA          1
+
+typedef struct {
+  uint16_t SPIEN;
+} SPISTATBITS;
+
+typedef struct {
+  uint16_t MODE16;
+} SPICON1BITS;
+
+extern uint16_t SPI1CON1, SPI1CON2, SPI1STAT;
+extern SPICON1BITS SPI1CON1bits;
+extern SPISTATBITS SPI1STATbits;
+uint16_t compute_spi_prescale(uint32_t u32_fcy, uint32_t u32_sckHz);
+uint16_t ioMasterSPI1(uint16_t u16_c);
+void writeBlockSPI1(const uint8_t *pu8_data, uint16_t u16_len);
+void writeQueueSPI1(uint8_t u8_c, uint8_t u8_tag);
+uint8_t isIdleQueueSPI1(void);
+
+// TIME (the simulated clock)
+void configTime32(void);
+void retuneTime32(void);
+uint32_t micros(void);
+uint32_t millis(void);
+
+static inline uint32_t deadlineUs(uint32_t u32_us) {
+  return micros() + u32_us;
+}
+
+static inline uint8_t isDeadlinePassed(uint32_t u32_deadline) {
+  return (int32_t) (micros() - u32_deadline) >= 0;
+}
+
+static inline uint32_t usUntil(uint32_t u32_deadline) {
+  int32_t i32_left = (int32_t) (u32_deadline - micros());
+  return i32_left > 0 ? (uint32_t) i32_left : 0;
+}
+
+// I2C (lc515.c puts a 24LC515 on I2C1; otherwise hal.c stands in
+// for the whole of eeprom.c)
+#define I2C_ACK     0
+#define I2C_NAK     1
+#define I2C_TIMEOUT 2
+
+typedef struct {
+  uint16_t I2CEN;
+} I2CCONBITS;
+
+extern I2CCONBITS I2C1CONbits;
+
+#define I2C_OP_START  0
+#define I2C_OP_WRITE  1
+#define I2C_OP_READ   2
+#define I2C_OP_STOP   3
+
+#define I2C_XFER_OK       0
+#define I2C_XFER_NAK      1
+#define I2C_XFER_PENDING  2
+#define I2C_XFER_TIMEOUT  3
+
+typedef struct {
+  uint8_t u8_op;
+  uint8_t* pu8_data;
+  uint16_t u16_len;
+} I2C_STEP;
+
+typedef struct I2C_XFER {
+  const I2C_STEP* pst_steps;
+  uint8_t u8_steps;
+  void (*pfn_done)(struct I2C_XFER* pst_xfer);
+  void* p_arg;
+  volatile uint8_t u8_status;
+} I2C_XFER;
+
+void configI2C1(uint16_t u16_FkHZ);
+void startI2C1(void);
+void rstartI2C1(void);
+void stopI2C1(void);
+void putI2C1(uint8_t u8_val);
+uint8_t putNoAckCheckI2C1(uint8_t u8_val);
+uint8_t getI2C1(uint8_t u8_ack2Send);
+uint8_t tryStartI2C1(void);
+uint8_t tryRstartI2C1(void);
+uint8_t tryStopI2C1(void);
+uint8_t tryPutI2C1(uint8_t u8_val);
+uint8_t tryGetI2C1(uint8_t u8_ack2Send, uint8_t *pu8_byte);
+void recoverI2C1(void);
+uint8_t queueI2C1(I2C_XFER *pst_xfer);
+uint8_t isIdleQueueI2C1(void);
+void abortQueueI2C1(void);
+
+// UART1 (never full)
+#define DEFAULT_BAUDRATE     230400
+#define DEFAULT_BRGH1        0
+#define IS_TRANSMIT_BUFFER_FULL_UART1() 0
+#define IS_TRANSMIT_COMPLETE_UART1() 1
+extern uint16_t U1BRG;
+uint16_t compute_brg(uint32_t u32_fcy, uint16_t u16_brgh, uint32_t u32_baudrate);
+void outChar1(uint8_t u8_c);
+
+#endif	/* PIC24_ALL_HOST_H */
@@ -0,0 +1,183 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * RECORDING PLAYBACK
+ * 
+ * Replays a recording (replay.c) through the game rules and checks it
+ * ends the way it did when it was recorded, so a bug report or a
+ * performance regression from the board can be rerun exactly.
+ * 
+ * usage: playback [-e image] [-i script] [-s seed] [-w image] [-o script] [-f]
+ *   -e image   24LC515 image (64 KB dump) with a recording at REPLAY_ADDR
+ *   -i script  record a bubblesim input script instead, '-' is stdin
+ *   -s seed    seed for -i (default 20, like the PIC)
+ *   -w image   store the recording in an image, as the PIC does
+ *   -o script  write the recorded inputs as a script, '-' is stdout
+ *   -f         draw every frame to stdout
+ * 
+ * Exits with 1 if the replayed game doesn't match the recording (a
+ * truncated one only has its frames checked: the game went on).
+ **/
+
+#include <getopt.h>
+#include "pic24_all.h"
+#include "game.h"
+#include "replay.h"
+#include "nokia_5110.h"
+
+// FILE SPECIFIC FUNCTIONS
+static void record_script(struct replay *r, const char *path, uint16_t u16_seed);
+static void write_script(struct replay *r, const char *path);
+static void print_frame(const uint8_t *pu8_lcd);
+
+// FILE SPECIFIC VARIABLES
+static struct replay rec;
+
+/**
+ * Plays a script like bubblesim does, recording like the PIC does
+ */
+static void record_script(struct replay *r, const char *path, uint16_t u16_seed) {
+  FILE *f;
+  struct game game;
+  int c;
+  
+  f = strcmp(path, "-") ? fopen(path, "r") : stdin;
+  if (!f) {
+    perror(path);
+    exit(2);
+  }
+  
+  game_init(&game, u16_seed);
+  replay_record_start(r, u16_seed);
+  while (game.u8_running && (c = fgetc(f)) != EOF) {
+    if (c != '0' && c != '1') continue;
+    replay_record(r, c == '1');
+    game_step(&game, c == '1');
+  }
+  replay_record_end(r, game.u8_score);
+  if (f != stdin) fclose(f);
+}
+
+/**
+ * Writes the inputs as '0'/'1' per frame, 64 frames to a row
+ */
+static void write_script(struct replay *r, const char *path) {
+  FILE *f;
+  uint16_t u16_i;
+  
+  f = strcmp(path, "-") ? fopen(path, "w") : stdout;
+  if (!f) {
+    perror(path);
+    exit(2);
+  }
+  
+  replay_play_start(r);
+  for (u16_i = 0; u16_i < r->u16_frames; u16_i++) {
+    fputc(replay_play(r) ? '1' : '0', f);
+    if (u16_i % 64 == 63 || u16_i == r->u16_frames - 1) fputc('\n', f);
+  }
+  if (f != stdout) fclose(f);
+}
+
+static void print_frame(const uint8_t *pu8_lcd) {
+  hal_print_frame(pu8_lcd);
+}
+
+int main(int argc, char **argv) {
+  const char *image = NULL, *script = NULL, *outImage = NULL, *outScript = NULL;
+  uint16_t u16_seed = 20;
+  uint8_t u8_draw = 0, u8_pressed;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "e:i:s:w:o:f")) != -1) {
+    switch (opt) {
+      case 'e': image = optarg; break;
+      case 'i': script = optarg; break;
+      case 's': u16_seed = strtoul(optarg, NULL, 0); break;
+      case 'w': outImage = optarg; break;
+      case 'o': outScript = optarg; break;
+      case 'f': u8_draw = 1; break;
+      default:
+        fprintf(stderr, "usage: %s [-e image] [-i script] [-s seed] "
+                        "[-w image] [-o script] [-f]\n", argv[0]);
+        return 2;
+    }
+  }
+  
+  // get the recording
+  if (script) {
+    record_script(&rec, script, u16_seed);
+  } else if (image) {
+    if (!hal_eeprom_load(image)) {
+      perror(image);
+      return 2;
+    }
+    if (!replay_load(&rec, REPLAY_ADDR)) {
+      fprintf(stderr, "%s: no recording at 0x%04X\n", image, REPLAY_ADDR);
+      return 2;
+    }
+  } else {
+    fprintf(stderr, "%s: need -e image or -i script\n", argv[0]);
+    return 2;
+  }
+  printf("recording: seed %u  frames %u  score %u  %u bytes%s\n", rec.u16_seed,
+         rec.u16_frames, rec.u8_score, REPLAY_HEADER + rec.u16_runs,
+         rec.u8_truncated ? "  truncated" : "");
+  
+  if (outImage) {
+    replay_save(&rec, REPLAY_ADDR);
+    if (!hal_eeprom_save(outImage)) {
+      perror(outImage);
+      return 2;
+    }
+  }
+  if (outScript) write_script(&rec, outScript);
+  
+  // replay it
+  if (u8_draw) hal_set_frame_sink(print_frame);
+  
+  struct game game;
+  game_init(&game, rec.u16_seed);
+  replay_play_start(&rec);
+  while (game.u8_running && !replay_play_done(&rec)) {
+    u8_pressed = replay_play(&rec);
+    hal_pb_set(u8_pressed);
+    
+    if (u8_draw) {
+      game_draw(&game);
+      NOK_UPDATE();
+    }
+    
+    if (!game_step(&game, u8_pressed) && u8_draw) {
+      game_draw_crash(&game);
+      NOK_UPDATE();
+    }
+  }
+  
+  if (rec.u16_played != rec.u16_frames || (!rec.u8_truncated && game.u8_score != rec.u8_score)) {
+    printf("replayed:  frames %u  score %u  MISMATCH\n", rec.u16_played, game.u8_score);
+    return 1;
+  }
+  printf("replayed:  frames %u  score %u  ok\n", rec.u16_played, game.u8_score);
+  return 0;
+}
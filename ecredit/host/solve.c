@@ -0,0 +1,151 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * COURSE SOLVER
+ * 
+ * Runs the optimal-play solver (solver.c) over one or more courses and
+ * reports whether each can be survived and the best score on it. The
+ * best line can be saved as a bubblesim input script.
+ * 
+ * Merging states makes "unsurvivable" approximate, so a course with no
+ * line is solved again with twice the cells per pixel, up to -Q, before
+ * it is rejected. The cell size each result was reached at is printed.
+ * 
+ * usage: solve [-s seed] [-n seeds] [-m frames] [-q cells] [-Q cells]
+ *              [-o script]
+ *              [-g gravity] [-f flap] [-H height] [-S spacing] [-R range]
+ *   -s seed     first course seed (default 20, like the PIC)
+ *   -n seeds    courses to solve, seeds count up from -s (default 1)
+ *   -m frames   a course is survivable if a line lasts this long
+ *               (default 3000)
+ *   -q cells    cells per pixel when merging states (default 1);
+ *               higher is slower but can find tighter lines
+ *   -Q cells    finest cells per pixel tried before calling a course
+ *               unsurvivable (default 8)
+ *   -o script   write the best line of the first course, '-' is stdout
+ *   -g -f -H -S -R  game_tuning knobs, as for tuner
+ **/
+
+#include <getopt.h>
+#include <time.h>
+#include "pic24_all.h"
+#include "game.h"
+#include "solver.h"
+
+#define SOLVE_MAX_FRAMES 3000
+#define SOLVE_MAX_CELLS 8
+
+// FILE SPECIFIC FUNCTIONS
+static void write_script(const char *path, const uint8_t *pu8_line, uint16_t u16_len);
+
+/**
+ * Writes a line as '0'/'1' per frame, 64 frames to a row
+ */
+static void write_script(const char *path, const uint8_t *pu8_line, uint16_t u16_len) {
+  FILE *f;
+  uint16_t u16_i;
+  
+  f = strcmp(path, "-") ? fopen(path, "w") : stdout;
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  
+  for (u16_i = 0; u16_i < u16_len; u16_i++) {
+    fputc(pu8_line[u16_i] ? '1' : '0', f);
+    if (u16_i % 64 == 63 || u16_i == u16_len - 1) fputc('\n', f);
+  }
+  if (f != stdout) fclose(f);
+}
+
+int main(int argc, char **argv) {
+  struct game_tuning tuning = GAME_TUNING_DEFAULT;
+  struct solver_result res;
+  uint32_t u32_seed = 20, u32_seeds = 1, u32_s, u32_dead = 0;
+  uint16_t u16_maxFrames = SOLVE_MAX_FRAMES;
+  uint8_t u8_cells = 1, u8_maxCells = SOLVE_MAX_CELLS, u8_q, *pu8_line;
+  char *script = NULL;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "s:n:m:q:Q:o:g:f:H:S:R:")) != -1) {
+    switch (opt) {
+      case 's': u32_seed = strtoul(optarg, NULL, 0); break;
+      case 'n': u32_seeds = strtoul(optarg, NULL, 0); break;
+      case 'm': u16_maxFrames = strtoul(optarg, NULL, 0); break;
+      case 'q': u8_cells = strtoul(optarg, NULL, 0); break;
+      case 'Q': u8_maxCells = strtoul(optarg, NULL, 0); break;
+      case 'o': script = optarg; break;
+      case 'g': tuning.f_gravity = strtof(optarg, NULL); break;
+      case 'f': tuning.f_flap = strtof(optarg, NULL); break;
+      case 'H': tuning.i8_gapHeight = strtol(optarg, NULL, 0); break;
+      case 'S': tuning.u8_gapSpacing = strtoul(optarg, NULL, 0); break;
+      case 'R': tuning.u8_gapRange = strtoul(optarg, NULL, 0); break;
+      default:
+        fprintf(stderr, "usage: %s [-s seed] [-n seeds] [-m frames] [-q cells] "
+                        "[-Q cells] [-o script]\n"
+                        "          [-g gravity] [-f flap] [-H height] "
+                        "[-S spacing] [-R range]\n", argv[0]);
+        return 2;
+    }
+  }
+  
+  if (!u8_cells) u8_cells = 1;
+  if (u8_maxCells < u8_cells) u8_maxCells = u8_cells;
+  pu8_line = malloc(u16_maxFrames ? u16_maxFrames : 1);
+  
+  for (u32_s = 0; u32_s < u32_seeds; u32_s++) {
+    clock_t start = clock();
+    
+    // no line is only approximate, so retry finer before rejecting
+    u8_q = u8_cells;
+    for (;;) {
+      if (!solver_run(u32_seed + u32_s, &tuning, u16_maxFrames, u8_q,
+                      &res, pu8_line)) {
+        fprintf(stderr, "seed %u: out of memory\n", (unsigned) (u32_seed + u32_s));
+        return 1;
+      }
+      if (res.u8_survivable || u8_q >= u8_maxCells) break;
+      u8_q = u8_q > u8_maxCells / 2 ? u8_maxCells : u8_q * 2;
+    }
+    
+    double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("seed %u  %s  best %u  frames %u  states %lu  cells %u  %.3f s\n",
+           (unsigned) (u32_seed + u32_s),
+           res.u8_survivable ? "survivable  " : "UNSURVIVABLE",
+           res.u8_bestScore, res.u16_frames, (unsigned long) res.u32_states,
+           u8_q, secs);
+    if (!res.u8_survivable) u32_dead++;
+    
+    if (script && u32_s == 0) write_script(script, pu8_line, res.u16_lineLen);
+  }
+  
+  if (u32_seeds > 1) {
+    printf("%u of %u courses can't be survived for %u frames",
+           (unsigned) u32_dead, (unsigned) u32_seeds, u16_maxFrames);
+    if (u32_dead) printf(" (approximate, at %u cells per pixel)", u8_maxCells);
+    printf("\n");
+  }
+  
+  free(pu8_line);
+  return u32_dead ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * OPTIMAL-PLAY SOLVER
+ * 
+ * Each frame, every surviving state is stepped with the button up and
+ * down. New states are merged when they land in the same cell of
+ * (y, dy) with the same gap underway, keeping the higher score. The
+ * merged states are not the same state: they differ below the cell size,
+ * and the swept collision also looks at where the bubble was last frame
+ * (pDot.px/py), so the dropped one may have had a future the kept one
+ * lacks. States that crash are dropped, but the best crash is remembered
+ * in case nothing survives.
+ * 
+ * Cells are 1/u8_cells px wide. Every kept state is a real game state,
+ * so the line that comes out always replays exactly in bubblesim, and a
+ * survivable result is exact. An unsurvivable one is only approximate at
+ * u8_cells: a finer cell size can still find a line.
+ **/
+
+#include <math.h>
+#include "pic24_all.h"
+#include "solver.h"
+
+#define SOLVER_EMPTY 0xFFFFFFFF
+#define SOLVER_START_CAP 1024
+
+// how a state was reached, for walking back to the start
+struct step {
+  uint32_t u32_parent;  // index into the previous frame's steps
+  uint8_t u8_input;
+};
+
+// a live state at the current frame
+struct node {
+  struct game g;
+  uint32_t u32_key;
+};
+
+// all the search's memory
+struct search {
+  struct node *cur, *nxt;
+  uint32_t u32_cap;         // nodes in cur and nxt
+  uint32_t *pu32_table;     // cell -> index into nxt
+  uint32_t u32_mask;        // table size - 1
+  struct step *steps;       // every frame's steps, back to back
+  uint32_t u32_nSteps, u32_stepCap;
+};
+
+// FILE SPECIFIC FUNCTIONS
+static uint32_t state_key(const struct game *g, uint8_t u8_cells);
+static uint32_t hash_key(uint32_t u32_key);
+static uint32_t *table_find(struct search *s, uint32_t u32_key);
+static uint8_t grow_nodes(struct search *s, uint32_t u32_n);
+static uint8_t push_step(struct search *s, uint32_t u32_parent, uint8_t u8_input);
+
+/**
+ * Packs the part of a game that depends on the input
+ */
+static uint32_t state_key(const struct game *g, uint8_t u8_cells) {
+  int32_t i32_y, i32_dy;
+  
+  i32_y = (int32_t) floorf(g->pDot.y * u8_cells);
+  i32_dy = (int32_t) lroundf(g->pDot.dy * u8_cells);
+  
+  return ((uint32_t) (i32_y & 0x3FFF) << 18) |
+         ((uint32_t) (i32_dy & 0x3FF) << 8) |
+         g->u8_ingap;
+}
+
+static uint32_t hash_key(uint32_t u32_key) {
+  u32_key ^= u32_key >> 16;
+  u32_key *= 0x7FEB352D;
+  u32_key ^= u32_key >> 15;
+  return u32_key;
+}
+
+/**
+ * Finds the table slot for a cell, empty if the cell is new
+ */
+static uint32_t *table_find(struct search *s, uint32_t u32_key) {
+  uint32_t u32_slot = hash_key(u32_key) & s->u32_mask;
+  
+  while (s->pu32_table[u32_slot] != SOLVER_EMPTY &&
+         s->nxt[s->pu32_table[u32_slot]].u32_key != u32_key) {
+    u32_slot = (u32_slot + 1) & s->u32_mask;
+  }
+  return &s->pu32_table[u32_slot];
+}
+
+/**
+ * Doubles the frame buffers and the table, keeping the first u32_n of nxt
+ * @return 1, if ok; 0, if out of memory
+ */
+static uint8_t grow_nodes(struct search *s, uint32_t u32_n) {
+  struct node *p;
+  uint32_t *pu32, u32_i;
+  uint32_t u32_cap = s->u32_cap ? s->u32_cap * 2 : SOLVER_START_CAP;
+  
+  if (!(p = realloc(s->cur, u32_cap * sizeof(struct node)))) return 0;
+  s->cur = p;
+  if (!(p = realloc(s->nxt, u32_cap * sizeof(struct node)))) return 0;
+  s->nxt = p;
+  if (!(pu32 = realloc(s->pu32_table, u32_cap * 2 * sizeof(uint32_t)))) return 0;
+  s->pu32_table = pu32;
+  s->u32_cap = u32_cap;
+  s->u32_mask = u32_cap * 2 - 1;
+  
+  // rehash what's already there
+  memset(s->pu32_table, 0xFF, u32_cap * 2 * sizeof(uint32_t));
+  for (u32_i = 0; u32_i < u32_n; u32_i++) {
+    *table_find(s, s->nxt[u32_i].u32_key) = u32_i;
+  }
+  return 1;
+}
+
+/**
+ * Appends a step to the history
+ * @return 1, if ok; 0, if out of memory
+ */
+static uint8_t push_step(struct search *s, uint32_t u32_parent, uint8_t u8_input) {
+  struct step *p;
+  
+  if (s->u32_nSteps == s->u32_stepCap) {
+    s->u32_stepCap = s->u32_stepCap ? s->u32_stepCap * 2 : SOLVER_START_CAP * 16;
+    if (!(p = realloc(s->steps, s->u32_stepCap * sizeof(struct step)))) return 0;
+    s->steps = p;
+  }
+  s->steps[s->u32_nSteps].u32_parent = u32_parent;
+  s->steps[s->u32_nSteps].u8_input = u8_input;
+  s->u32_nSteps++;
+  return 1;
+}
+
+/**
+ * Solves one course
+ * @param u16_seed course seed
+ * @param tuning knobs, NULL for the default
+ * @param u16_maxFrames stop once a line lasts this long
+ * @param u8_cells cells per pixel when merging states (1 is plenty)
+ * @param res results
+ * @param pu8_line if not NULL, gets the best line (u16_maxFrames bytes)
+ * @return 1, if ok; 0, if out of memory
+ */
+uint8_t solver_run(uint16_t u16_seed, const struct game_tuning *tuning,
+                   uint16_t u16_maxFrames, uint8_t u8_cells,
+                   struct solver_result *res, uint8_t *pu8_line) {
+  struct search s = {0};
+  struct node *tmp, *n;
+  uint32_t *pu32_slot;
+  uint32_t u32_nCur, u32_nNxt, u32_i, u32_prev, u32_here;
+  uint32_t u32_bestParent = SOLVER_EMPTY;
+  uint16_t u16_f, u16_bestFrames = 0, u16_bestLen = 0;
+  uint8_t u8_in, u8_bestInput = 0, u8_bestScore = 0, u8_ok = 0;
+  
+  if (!tuning) tuning = &GAME_TUNING_DEFAULT;
+  if (!u8_cells) u8_cells = 1;
+  if (!grow_nodes(&s, 0)) goto done;
+  
+  // frame 0: one state, no history
+  game_init_tuned(&s.cur[0].g, u16_seed, tuning);
+  u32_nCur = 1;
+  if (!push_step(&s, SOLVER_EMPTY, 0)) goto done;
+  u32_prev = 0;
+  
+  for (u16_f = 0; u16_f < u16_maxFrames && u32_nCur; u16_f++) {
+    memset(s.pu32_table, 0xFF, (s.u32_mask + 1) * sizeof(uint32_t));
+    u32_here = s.u32_nSteps;
+    u32_nNxt = 0;
+    
+    for (u32_i = 0; u32_i < u32_nCur; u32_i++) {
+      for (u8_in = 0; u8_in < 2; u8_in++) {
+        if (u32_nNxt == s.u32_cap && !grow_nodes(&s, u32_nNxt)) goto done;
+        n = &s.nxt[u32_nNxt];
+        n->g = s.cur[u32_i].g;
+        
+        // crashed: only interesting if it beats the best line
+        if (!game_step(&n->g, u8_in)) {
+          if (n->g.u8_score > u8_bestScore ||
+              (n->g.u8_score == u8_bestScore && u16_f > u16_bestFrames)) {
+            u8_bestScore = n->g.u8_score;
+            u16_bestFrames = u16_f;
+            u16_bestLen = u16_f + 1;
+            u32_bestParent = u32_prev + u32_i;
+            u8_bestInput = u8_in;
+          }
+          continue;
+        }
+        
+        // same cell as a state already reached: keep the better score
+        n->u32_key = state_key(&n->g, u8_cells);
+        pu32_slot = table_find(&s, n->u32_key);
+        if (*pu32_slot != SOLVER_EMPTY) {
+          if (n->g.u8_score > s.nxt[*pu32_slot].g.u8_score) {
+            s.nxt[*pu32_slot].g = n->g;
+            s.steps[u32_here + *pu32_slot].u32_parent = u32_prev + u32_i;
+            s.steps[u32_here + *pu32_slot].u8_input = u8_in;
+          }
+          continue;
+        }
+        
+        // new state
+        if (!push_step(&s, u32_prev + u32_i, u8_in)) goto done;
+        *pu32_slot = u32_nNxt++;
+      }
+    }
+    
+    // the survivors become the frame
+    tmp = s.cur;
+    s.cur = s.nxt;
+    s.nxt = tmp;
+    u32_nCur = u32_nNxt;
+    u32_prev = u32_here;
+    
+    for (u32_i = 0; u32_i < u32_nCur; u32_i++) {
+      if (s.cur[u32_i].g.u8_score > u8_bestScore ||
+          (s.cur[u32_i].g.u8_score == u8_bestScore && u16_f + 1 > u16_bestFrames)) {
+        u8_bestScore = s.cur[u32_i].g.u8_score;
+        u16_bestFrames = u16_f + 1;
+        u16_bestLen = u16_f + 1;
+        u32_bestParent = s.steps[u32_prev + u32_i].u32_parent;
+        u8_bestInput = s.steps[u32_prev + u32_i].u8_input;
+      }
+    }
+  }
+  
+  res->u8_survivable = (u32_nCur > 0);
+  res->u8_bestScore = u8_bestScore;
+  res->u16_frames = u16_bestFrames;
+  res->u16_lineLen = u16_bestLen;
+  res->u32_states = s.u32_nSteps;
+  
+  // walk the best line back to the start
+  if (pu8_line) {
+    memset(pu8_line, 0, u16_maxFrames);
+    for (u16_f = u16_bestLen; u16_f > 0; u16_f--) {
+      pu8_line[u16_f - 1] = u8_bestInput;
+      u8_bestInput = s.steps[u32_bestParent].u8_input;
+      u32_bestParent = s.steps[u32_bestParent].u32_parent;
+    }
+  }
+  u8_ok = 1;
+  
+  done:
+  free(s.cur);
+  free(s.nxt);
+  free(s.pu32_table);
+  free(s.steps);
+  return u8_ok;
+}
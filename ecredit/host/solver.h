@@ -0,0 +1,51 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * OPTIMAL-PLAY SOLVER
+ * 
+ * Finds the best score a perfect player can get on a course.
+ * The gaps don't depend on the input, so each frame only the player's
+ * state differs between lines of play; a breadth-first search keeps
+ * every distinct (y, dy, gap) state reachable at that frame.
+ **/
+
+#ifndef SOLVER_H
+#define	SOLVER_H
+
+#include <stdint.h>
+#include "game.h"
+
+struct solver_result {
+  uint8_t u8_survivable;  // 1, if some line lasts the whole search; 0 is
+                          // approximate, finer cells may still find one
+  uint8_t u8_bestScore;   // best score of any line
+  uint16_t u16_frames;    // frames the best line survives
+  uint16_t u16_lineLen;   // inputs in the best line, with the crash if any
+  uint32_t u32_states;    // distinct states kept, over all frames
+};
+
+uint8_t solver_run(uint16_t u16_seed, const struct game_tuning *tuning,
+                   uint16_t u16_maxFrames, uint8_t u8_cells,
+                   struct solver_result *res, uint8_t *pu8_line);
+
+#endif	/* SOLVER_H */
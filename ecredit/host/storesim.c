@@ -0,0 +1,251 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * RECORD STORE SIMULATION
+ * 
+ * Runs random puts and deletes against the record store (store.c) on
+ * the host's 24LC515 image, checks every key against a model after
+ * each reboot, and reports the cost: simulated time per operation,
+ * write cycles, and how evenly they fall on the store's pages.
+ * 
+ * usage: storesim [-n ops] [-s seed] [-k keys] [-c percent] [-a] [-e image] [-w image]
+ *   -n ops      operations (default 10000)
+ *   -s seed     PRNG seed (default 1)
+ *   -k keys     keys to use, from 0 (default STORE_KEYS)
+ *   -c percent  cut the power part way through this % of operations,
+ *               then reboot (store_init) and check (default 0)
+ *   -a          make the puts and deletes a write at a time from
+ *               store_step, as the firmware's eeprom_task does
+ *   -e image    image to start from (default blank)
+ *   -w image    save the image at the end
+ * 
+ * Exits with 1 if a key ever reads back wrong: after a cut, a key must
+ * hold either its old value or its new one.
+ **/
+
+#include <getopt.h>
+#include "pic24_all.h"
+#include "store.h"
+
+#define SIM_REBOOT_OPS 1000   // reboot and check this often anyway
+
+// a key's value, in the model
+struct value {
+  uint8_t u8_len;             // STORE_NONE: no such key
+  uint8_t au8_data[STORE_MAX_VALUE];
+};
+
+// FILE SPECIFIC FUNCTIONS
+static uint32_t xorshift(uint32_t *pu32_s);
+static uint8_t read_key(uint8_t u8_key, struct value *v);
+static uint8_t same_value(const struct value *a, const struct value *b);
+static uint8_t check_all(uint8_t u8_keys);
+static uint8_t step_all(void);
+
+// FILE SPECIFIC VARIABLES
+static struct value aModel[STORE_KEYS];
+
+/**
+ * Small, fast PRNG for the operations
+ */
+static uint32_t xorshift(uint32_t *pu32_s) {
+  uint32_t x = *pu32_s;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *pu32_s = x;
+}
+
+/**
+ * Reads a key from the store into a model value
+ * @return its length, or STORE_NONE
+ */
+static uint8_t read_key(uint8_t u8_key, struct value *v) {
+  v->u8_len = store_get(u8_key, v->au8_data, STORE_MAX_VALUE);
+  return v->u8_len;
+}
+
+static uint8_t same_value(const struct value *a, const struct value *b) {
+  if (a->u8_len != b->u8_len) return 0;
+  return a->u8_len == STORE_NONE || !memcmp(a->au8_data, b->au8_data, a->u8_len);
+}
+
+/**
+ * Checks every key, and that store_next() goes through just those
+ * @return 1, if the store matches the model
+ */
+static uint8_t check_all(uint8_t u8_keys) {
+  struct value v;
+  uint8_t u8_key, u8_next = store_next(0);
+  
+  for (u8_key = 0; u8_key < u8_keys; u8_key++) {
+    read_key(u8_key, &v);
+    if (!same_value(&v, &aModel[u8_key])) {
+      fprintf(stderr, "key %u: read %u bytes, expected %u\n", u8_key, v.u8_len, aModel[u8_key].u8_len);
+      return 0;
+    }
+    if (v.u8_len != STORE_NONE) {
+      if (u8_next != u8_key) {
+        fprintf(stderr, "store_next: %u, expected %u\n", u8_next, u8_key);
+        return 0;
+      }
+      u8_next = store_next(u8_key + 1);
+    }
+  }
+  return 1;
+}
+
+/**
+ * Makes the writes of the operation store_put_start or
+ * store_delete_start started, waiting out each write cycle
+ * @return 1 (the image model never stops answering)
+ */
+static uint8_t step_all(void) {
+  struct store_write w;
+  
+  while (store_step(&w)) {
+    store_step_done(EEPROM_WRITE_PAGE(w.u16_addr, w.pu8_data, w.u8_len) == w.u8_len &&
+                    EEPROM_WAIT_WRITE());
+  }
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  const char *image = NULL, *outImage = NULL;
+  uint32_t u32_ops = 10000, u32_rng = 1, u32_cutPercent = 0;
+  uint32_t u32_op, u32_start, u32_us, u32_opMax = 0, u32_cuts = 0, u32_full = 0;
+  uint64_t u64_opUs = 0, u64_payload = 0;
+  uint32_t u32_programs, u32_min = HAL_NO_CUT, u32_max = 0, u32_sum = 0;
+  uint8_t u8_keys = STORE_KEYS, u8_key, u8_cut, u8_ok, u8_step = 0;
+  struct value next, got;
+  uint16_t u16_page;
+  int opt;
+  
+  while ((opt = getopt(argc, argv, "n:s:k:c:ae:w:")) != -1) {
+    switch (opt) {
+      case 'n': u32_ops = strtoul(optarg, NULL, 0); break;
+      case 's': u32_rng = strtoul(optarg, NULL, 0); break;
+      case 'k': u8_keys = strtoul(optarg, NULL, 0); break;
+      case 'c': u32_cutPercent = strtoul(optarg, NULL, 0); break;
+      case 'a': u8_step = 1; break;
+      case 'e': image = optarg; break;
+      case 'w': outImage = optarg; break;
+      default:
+        fprintf(stderr, "usage: %s [-n ops] [-s seed] [-k keys] [-c percent] [-a] "
+                        "[-e image] [-w image]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (u8_keys == 0 || u8_keys > STORE_KEYS) u8_keys = STORE_KEYS;
+  if (u32_rng == 0) u32_rng = 1;
+  if (image && !hal_eeprom_load(image)) {
+    perror(image);
+    return 2;
+  }
+  
+  // boot, and take what is there as the model
+  u32_start = micros();
+  store_init();
+  u32_us = micros() - u32_start;
+  for (u8_key = store_next(0), u8_ok = 0; u8_key != STORE_NONE; u8_key = store_next(u8_key + 1)) u8_ok++;
+  printf("boot: %u keys, %u of %u bytes live, %lu ms\n", u8_ok, store_live(),
+         store_capacity(), (unsigned long) (u32_us / 1000));
+  for (u8_key = 0; u8_key < STORE_KEYS; u8_key++) read_key(u8_key, &aModel[u8_key]);
+  
+  for (u32_op = 0; u32_op < u32_ops; u32_op++) {
+    // a put of random bytes (4 in 5), or a delete
+    u8_key = xorshift(&u32_rng) % u8_keys;
+    if (xorshift(&u32_rng) % 5) {
+      next.u8_len = xorshift(&u32_rng) % (STORE_MAX_VALUE + 1);
+      for (u8_cut = 0; u8_cut < next.u8_len; u8_cut++) next.au8_data[u8_cut] = xorshift(&u32_rng);
+    } else {
+      next.u8_len = STORE_NONE;
+    }
+    
+    u8_cut = xorshift(&u32_rng) % 100 < u32_cutPercent;
+    if (u8_cut) hal_eeprom_cut(xorshift(&u32_rng) % (STORE_MAX_VALUE + 8));
+    
+    u32_start = micros();
+    if (next.u8_len == STORE_NONE) {
+      u8_ok = (u8_step ? store_delete_start(u8_key) && step_all() : store_delete(u8_key)) ||
+              aModel[u8_key].u8_len == STORE_NONE;
+    } else {
+      u8_ok = u8_step ? store_put_start(u8_key, next.au8_data, next.u8_len) && step_all()
+                      : store_put(u8_key, next.au8_data, next.u8_len);
+      if (u8_ok) u64_payload += next.u8_len;
+      else u32_full++;
+    }
+    u32_us = micros() - u32_start;
+    u64_opUs += u32_us;
+    if (u32_us > u32_opMax) u32_opMax = u32_us;
+    
+    if (u8_cut) {
+      // power back, reboot: either value will do, and is the model now
+      u8_cut = hal_eeprom_is_cut();
+      hal_eeprom_cut(HAL_NO_CUT);
+      store_init();
+      read_key(u8_key, &got);
+      if (!same_value(&got, &aModel[u8_key]) && !same_value(&got, &next)) {
+        fprintf(stderr, "op %lu: key %u neither old nor new after a cut\n", (unsigned long) u32_op, u8_key);
+        return 1;
+      }
+      aModel[u8_key] = got;
+      u32_cuts += u8_cut;
+    } else if (u8_ok) {
+      aModel[u8_key] = next;
+    }
+    
+    if (u8_cut || (u32_op + 1) % SIM_REBOOT_OPS == 0) {
+      store_init();
+      if (!check_all(u8_keys)) {
+        fprintf(stderr, "op %lu: store doesn't match\n", (unsigned long) u32_op);
+        return 1;
+      }
+    }
+  }
+  store_init();
+  if (!check_all(u8_keys)) return 1;
+  
+  // wear over the store's pages
+  for (u16_page = STORE_ADDR / EEPROM_PAGE; u16_page < HAL_EEPROM_PAGES; u16_page++) {
+    u32_programs = hal_eeprom_programs(u16_page);
+    if (u32_programs < u32_min) u32_min = u32_programs;
+    if (u32_programs > u32_max) u32_max = u32_programs;
+    u32_sum += u32_programs;
+  }
+  
+  printf("ops: %lu  cuts: %lu  full: %lu  ok\n", (unsigned long) u32_ops,
+         (unsigned long) u32_cuts, (unsigned long) u32_full);
+  printf("time: %.2f ms/op avg, %.2f ms max\n",
+         u32_ops ? u64_opUs / 1000.0 / u32_ops : 0.0, u32_opMax / 1000.0);
+  printf("wear: %lu write cycles, %.1f bytes each; per page min %lu avg %.1f max %lu\n",
+         (unsigned long) u32_sum, u32_sum ? (double) u64_payload / u32_sum : 0.0,
+         (unsigned long) u32_min, (double) u32_sum / (HAL_EEPROM_PAGES - STORE_ADDR / EEPROM_PAGE),
+         (unsigned long) u32_max);
+  
+  if (outImage && !hal_eeprom_save(outImage)) {
+    perror(outImage);
+    return 2;
+  }
+  return 0;
+}
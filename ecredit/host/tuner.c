@@ -0,0 +1,471 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * MONTE CARLO DIFFICULTY TUNER
+ * 
+ * Sweeps the game_tuning knobs, plays lots of simulated games for
+ * every combination under a family of input models, and reports the
+ * score distribution and survival curve of each. Games are cut into
+ * chunks and spread over a work-stealing pool of pthreads.
+ * 
+ * usage: tuner [-j threads] [-n games] [-m frames] [-s seed] [-v]
+ *              [-g lo:hi:step] [-f lo:hi:step] [-H lo:hi:step]
+ *              [-S lo:hi:step] [-R lo:hi:step] [-M model,model,...]
+ *   -j threads  workers (default: all cores)
+ *   -n games    games per combination (default 10000), each on its own
+ *               course: at most 65536, as many as there are seeds
+ *   -m frames   give up on a game after this many frames (default 3000)
+ *   -s seed     first course seed (default 20); the rest count up from
+ *               it, wrapping at 16 bits like the PIC's
+ *   -g          gravity sweep        (default 0.75:0.95:0.1)
+ *   -f          flap dy sweep        (default -2)
+ *   -H          gap height sweep     (default 13:17:2)
+ *   -S          gap spacing sweep    (default 20 frames)
+ *   -R          gap y range sweep    (default 31)
+ *   -M          input models (default aim:1,aim:2,aim:3, which last
+ *               long enough at the defaults to tell them apart)
+ *                 random:P           press P% of frames
+ *                 aim:N              steer for the next gap, +/-N px of noise
+ *                 markov:HOLD:START  keep holding HOLD%, start START%
+ *   -v          also print the score survival curve of each combination
+ **/
+
+#include <getopt.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "pic24_all.h"
+#include "game.h"
+
+#define TUNER_CHUNK       256   // games per task
+#define TUNER_MAX_VALUES  64    // values per swept knob
+#define TUNER_MAX_MODELS  16
+#define TUNER_BUCKET      25    // frames per survival bucket
+#define TUNER_MAX_FRAMES  3000
+#define TUNER_MAX_GAMES   65536 // courses: the seeds are 16 bits
+
+// INPUT MODELS
+#define MODEL_RANDOM 0
+#define MODEL_AIM    1
+#define MODEL_MARKOV 2
+
+struct model {
+  uint8_t u8_kind;
+  float f_a, f_b;
+  char name[24];
+};
+
+// one knob combination under one model
+struct job {
+  struct game_tuning tuning;
+  const struct model *model;
+  uint64_t au64_score[256];  // games ending with each score
+  uint64_t *pu64_death;      // games ending in each frame bucket
+  uint64_t u64_frames;
+};
+
+struct task {
+  uint32_t u32_job;
+  uint32_t u32_first;
+  uint32_t u32_count;
+};
+
+// per-worker deque: owner pops the tail, thieves take the head
+struct deque {
+  pthread_mutex_t lock;
+  struct task *tasks;
+  uint32_t u32_head, u32_tail;
+};
+
+// FILE SPECIFIC VARIABLES
+static struct job *jobs;
+static struct deque *deques;
+static uint32_t u32_workers;
+static uint32_t u32_maxFrames = TUNER_MAX_FRAMES;
+static uint32_t u32_buckets;
+static uint16_t u16_seed = 20;
+static volatile uint32_t u32_tasksLeft;
+
+// FILE SPECIFIC FUNCTIONS
+static uint32_t xorshift(uint32_t *pu32_s);
+static uint8_t model_input(const struct model *m, struct game *g, uint8_t u8_last, uint32_t *pu32_rng);
+static void play_task(const struct task *t);
+static uint8_t pop_task(uint32_t u32_self, struct task *t);
+static uint8_t steal_task(uint32_t u32_self, uint32_t *pu32_rng, struct task *t);
+static void* worker(void *arg);
+static uint32_t parse_range(const char *s, float *af_vals);
+static uint32_t parse_models(char *s, struct model *models);
+
+/**
+ * Small, fast PRNG for the input models
+ */
+static uint32_t xorshift(uint32_t *pu32_s) {
+  uint32_t x = *pu32_s;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *pu32_s = x;
+}
+
+/**
+ * Decides whether the simulated player presses this frame
+ */
+static uint8_t model_input(const struct model *m, struct game *g, uint8_t u8_last, uint32_t *pu32_rng) {
+  uint32_t u32_r = xorshift(pu32_rng);
+  uint8_t u8_i;
+  float f_target, f_noise, f_best;
+  
+  switch (m->u8_kind) {
+    case MODEL_RANDOM:
+      return (u32_r % 1000) < m->f_a * 10;
+      
+    case MODEL_MARKOV:
+      return (u32_r % 1000) < (u8_last ? m->f_a : m->f_b) * 10;
+      
+    case MODEL_AIM:
+    default:
+      // middle of the nearest gap still ahead, else middle of the screen
+      f_target = 20;
+      f_best = 1000;
+      for (u8_i = 0; u8_i < g->u8_count; u8_i++) {
+        struct entity_gap *gap = &g->gaps[u8_i];
+        if (gap->x + ENTITY_GAP_WIDTH < g->pDot.x - g->pDot.radius) continue;
+        if (gap->x < f_best) {
+          f_best = gap->x;
+          f_target = gap->y + gap->h / 2.0f;
+        }
+      }
+      
+      // misjudge where the dot is by up to +/- noise
+      f_noise = ((u32_r % 2001) / 1000.0f - 1.0f) * m->f_a;
+      return g->pDot.y + f_noise > f_target;
+  }
+}
+
+/**
+ * Plays one chunk of games and merges the results into its job
+ */
+static void play_task(const struct task *t) {
+  struct job *j = &jobs[t->u32_job];
+  uint64_t au64_score[256] = {0};
+  uint64_t au64_death[u32_buckets];
+  uint64_t u64_frames = 0;
+  uint32_t u32_g, u32_f, u32_rng;
+  uint8_t u8_pressed;
+  struct game game;
+  
+  memset(au64_death, 0, sizeof(au64_death));
+  
+  for (u32_g = t->u32_first; u32_g < t->u32_first + t->u32_count; u32_g++) {
+    game_init_tuned(&game, (uint16_t) (u16_seed + u32_g), &j->tuning);
+    u32_rng = (u32_g + 1) * 2654435761u ^ (t->u32_job + 1) * 40503u;
+    if (!u32_rng) u32_rng = 1;
+    
+    u8_pressed = 0;
+    for (u32_f = 0; u32_f < u32_maxFrames; u32_f++) {
+      u8_pressed = model_input(j->model, &game, u8_pressed, &u32_rng);
+      if (!game_step(&game, u8_pressed)) break;
+    }
+    
+    au64_score[game.u8_score]++;
+    au64_death[min(u32_f / TUNER_BUCKET, u32_buckets - 1)]++;
+    u64_frames += u32_f;
+  }
+  
+  // merge (other chunks of this job may be finishing right now)
+  for (u32_g = 0; u32_g < 256; u32_g++) {
+    if (au64_score[u32_g]) __atomic_fetch_add(&j->au64_score[u32_g], au64_score[u32_g], __ATOMIC_RELAXED);
+  }
+  for (u32_g = 0; u32_g < u32_buckets; u32_g++) {
+    if (au64_death[u32_g]) __atomic_fetch_add(&j->pu64_death[u32_g], au64_death[u32_g], __ATOMIC_RELAXED);
+  }
+  __atomic_fetch_add(&j->u64_frames, u64_frames, __ATOMIC_RELAXED);
+}
+
+/**
+ * Takes the newest task from our own deque
+ */
+static uint8_t pop_task(uint32_t u32_self, struct task *t) {
+  struct deque *d = &deques[u32_self];
+  uint8_t u8_ok = 0;
+  
+  pthread_mutex_lock(&d->lock);
+  if (d->u32_tail > d->u32_head) {
+    *t = d->tasks[--d->u32_tail];
+    u8_ok = 1;
+  }
+  pthread_mutex_unlock(&d->lock);
+  return u8_ok;
+}
+
+/**
+ * Takes the oldest task from someone else's deque
+ */
+static uint8_t steal_task(uint32_t u32_self, uint32_t *pu32_rng, struct task *t) {
+  uint32_t u32_i, u32_victim;
+  uint8_t u8_ok = 0;
+  
+  // start at a random victim so thieves spread out
+  u32_victim = xorshift(pu32_rng) % u32_workers;
+  for (u32_i = 0; u32_i < u32_workers && !u8_ok; u32_i++, u32_victim = (u32_victim + 1) % u32_workers) {
+    struct deque *d = &deques[u32_victim];
+    if (u32_victim == u32_self) continue;
+    
+    pthread_mutex_lock(&d->lock);
+    if (d->u32_tail > d->u32_head) {
+      *t = d->tasks[d->u32_head++];
+      u8_ok = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+  }
+  return u8_ok;
+}
+
+static void* worker(void *arg) {
+  uint32_t u32_self = (uint32_t) (uintptr_t) arg;
+  uint32_t u32_rng = u32_self * 747796405u + 1;
+  struct task t;
+  
+  while (__atomic_load_n(&u32_tasksLeft, __ATOMIC_ACQUIRE)) {
+    if (pop_task(u32_self, &t) || steal_task(u32_self, &u32_rng, &t)) {
+      play_task(&t);
+      __atomic_fetch_sub(&u32_tasksLeft, 1, __ATOMIC_RELEASE);
+    } else {
+      // the last few tasks are being played elsewhere
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Parses "lo:hi:step" (or a single value) into a list
+ */
+static uint32_t parse_range(const char *s, float *af_vals) {
+  float f_lo, f_hi, f_step;
+  uint32_t u32_n = 0;
+  int i_cnt = sscanf(s, "%f:%f:%f", &f_lo, &f_hi, &f_step);
+  
+  if (i_cnt < 1) {
+    fprintf(stderr, "bad range '%s'\n", s);
+    exit(2);
+  }
+  if (i_cnt == 1) f_hi = f_lo;
+  if (i_cnt < 3) f_step = 1;
+  if (f_step == 0 || (f_hi - f_lo) / f_step < 0) {
+    fprintf(stderr, "bad step in '%s'\n", s);
+    exit(2);
+  }
+  
+  // step from lo towards hi, allowing for float rounding at the end
+  while (u32_n < TUNER_MAX_VALUES &&
+         (f_step > 0 ? f_lo + u32_n * f_step <= f_hi + f_step * 1e-3f
+                     : f_lo + u32_n * f_step >= f_hi + f_step * 1e-3f)) {
+    af_vals[u32_n] = f_lo + u32_n * f_step;
+    u32_n++;
+  }
+  return u32_n;
+}
+
+/**
+ * Parses "random:10,aim:2,markov:60:8"
+ */
+static uint32_t parse_models(char *s, struct model *models) {
+  uint32_t u32_n = 0;
+  char *tok, *save;
+  
+  for (tok = strtok_r(s, ",", &save); tok && u32_n < TUNER_MAX_MODELS; tok = strtok_r(NULL, ",", &save)) {
+    struct model *m = &models[u32_n];
+    m->f_a = m->f_b = 0;
+    snprintf(m->name, sizeof(m->name), "%s", tok);
+    
+    if (sscanf(tok, "random:%f", &m->f_a) == 1) {
+      m->u8_kind = MODEL_RANDOM;
+    } else if (sscanf(tok, "aim:%f", &m->f_a) == 1) {
+      m->u8_kind = MODEL_AIM;
+    } else if (sscanf(tok, "markov:%f:%f", &m->f_a, &m->f_b) == 2) {
+      m->u8_kind = MODEL_MARKOV;
+    } else {
+      fprintf(stderr, "bad model '%s'\n", tok);
+      exit(2);
+    }
+    u32_n++;
+  }
+  return u32_n;
+}
+
+int main(int argc, char **argv) {
+  float af_grav[TUNER_MAX_VALUES], af_flap[TUNER_MAX_VALUES] = {PDOT_FLAP};
+  float af_height[TUNER_MAX_VALUES], af_spacing[TUNER_MAX_VALUES] = {20};
+  float af_range[TUNER_MAX_VALUES] = {ENTITY_GAP_RANGE};
+  uint32_t u32_nGrav = 0, u32_nFlap = 1, u32_nHeight = 0, u32_nSpacing = 1, u32_nRange = 1;
+  struct model models[TUNER_MAX_MODELS];
+  char defModels[] = "aim:1,aim:2,aim:3";
+  uint32_t u32_nModels = 0, u32_games = 10000;
+  uint8_t u8_verbose = 0;
+  int opt;
+  
+  u32_workers = sysconf(_SC_NPROCESSORS_ONLN);
+  
+  while ((opt = getopt(argc, argv, "j:n:m:s:g:f:H:S:R:M:v")) != -1) {
+    switch (opt) {
+      case 'j': u32_workers = strtoul(optarg, NULL, 0); break;
+      case 'n': u32_games = strtoul(optarg, NULL, 0); break;
+      case 'm': u32_maxFrames = strtoul(optarg, NULL, 0); break;
+      case 's': u16_seed = strtoul(optarg, NULL, 0); break;
+      case 'g': u32_nGrav = parse_range(optarg, af_grav); break;
+      case 'f': u32_nFlap = parse_range(optarg, af_flap); break;
+      case 'H': u32_nHeight = parse_range(optarg, af_height); break;
+      case 'S': u32_nSpacing = parse_range(optarg, af_spacing); break;
+      case 'R': u32_nRange = parse_range(optarg, af_range); break;
+      case 'M': u32_nModels = parse_models(optarg, models); break;
+      case 'v': u8_verbose = 1; break;
+      default:
+        fprintf(stderr, "usage: %s [-j threads] [-n games] [-m frames] [-s seed] [-v]\n"
+                        "       [-g lo:hi:step] [-f lo:hi:step] [-H lo:hi:step]\n"
+                        "       [-S lo:hi:step] [-R lo:hi:step] [-M model,model,...]\n", argv[0]);
+        return 2;
+    }
+  }
+  // by default, the PIC's gravity and gap height, and one step either side
+  if (!u32_nGrav) u32_nGrav = parse_range("0.75:0.95:0.1", af_grav);
+  if (!u32_nHeight) u32_nHeight = parse_range("13:17:2", af_height);
+  if (!u32_nModels) u32_nModels = parse_models(defModels, models);
+  if (u32_games > TUNER_MAX_GAMES) {
+    fprintf(stderr, "%u games: capped at %u, one per course\n", u32_games, TUNER_MAX_GAMES);
+    u32_games = TUNER_MAX_GAMES;
+  }
+  if (!u32_workers) u32_workers = 1;
+  if (!u32_games || !u32_maxFrames) return 0;
+  u32_buckets = (u32_maxFrames + TUNER_BUCKET - 1) / TUNER_BUCKET + 1;
+  
+  // every combination of knobs x models
+  uint32_t u32_nJobs = u32_nGrav * u32_nFlap * u32_nHeight * u32_nSpacing * u32_nRange * u32_nModels;
+  uint32_t u32_j = 0, a, b, c, d, e, m;
+  jobs = calloc(u32_nJobs, sizeof(struct job));
+  for (a = 0; a < u32_nGrav; a++)
+  for (b = 0; b < u32_nFlap; b++)
+  for (c = 0; c < u32_nHeight; c++)
+  for (d = 0; d < u32_nSpacing; d++)
+  for (e = 0; e < u32_nRange; e++)
+  for (m = 0; m < u32_nModels; m++, u32_j++) {
+    struct job *j = &jobs[u32_j];
+    j->tuning.f_gravity = af_grav[a];
+    j->tuning.f_flap = af_flap[b];
+    j->tuning.i8_gapHeight = af_height[c];
+    j->tuning.u8_gapSpacing = af_spacing[d];
+    j->tuning.u8_gapRange = af_range[e] < 1 ? 1 : af_range[e];
+    j->model = &models[m];
+    j->pu64_death = calloc(u32_buckets, sizeof(uint64_t));
+  }
+  
+  // deal the chunks round-robin; stealing evens out the rest
+  uint32_t u32_chunks = (u32_games + TUNER_CHUNK - 1) / TUNER_CHUNK;
+  uint32_t u32_perDeque = (u32_nJobs * u32_chunks + u32_workers - 1) / u32_workers;
+  uint32_t u32_w, u32_k = 0;
+  deques = calloc(u32_workers, sizeof(struct deque));
+  for (u32_w = 0; u32_w < u32_workers; u32_w++) {
+    pthread_mutex_init(&deques[u32_w].lock, NULL);
+    deques[u32_w].tasks = malloc(u32_perDeque * sizeof(struct task));
+  }
+  for (u32_j = 0; u32_j < u32_nJobs; u32_j++) {
+    uint32_t u32_c;
+    for (u32_c = 0; u32_c < u32_chunks; u32_c++, u32_k++) {
+      struct deque *dq = &deques[u32_k % u32_workers];
+      struct task *t = &dq->tasks[dq->u32_tail++];
+      t->u32_job = u32_j;
+      t->u32_first = u32_c * TUNER_CHUNK;
+      t->u32_count = min(TUNER_CHUNK, u32_games - t->u32_first);
+    }
+  }
+  u32_tasksLeft = u32_k;
+  
+  // play
+  struct timespec t0, t1;
+  pthread_t threads[u32_workers];
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (u32_w = 0; u32_w < u32_workers; u32_w++) {
+    pthread_create(&threads[u32_w], NULL, worker, (void *) (uintptr_t) u32_w);
+  }
+  for (u32_w = 0; u32_w < u32_workers; u32_w++) {
+    pthread_join(threads[u32_w], NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  
+  // report
+  uint64_t u64_allFrames = 0;
+  printf("gravity  flap  height spacing range  model              games   mean  p50  p90  max  frames"
+         "  alive@250 alive@500 alive@1000\n");
+  for (u32_j = 0; u32_j < u32_nJobs; u32_j++) {
+    struct job *j = &jobs[u32_j];
+    uint64_t u64_sum = 0, u64_seen = 0;
+    uint32_t u32_s, u32_p50 = 0, u32_p90 = 0, u32_max = 0;
+    uint8_t u8_have50 = 0, u8_have90 = 0;
+    
+    for (u32_s = 0; u32_s < 256; u32_s++) {
+      if (!j->au64_score[u32_s]) continue;
+      u64_sum += (uint64_t) u32_s * j->au64_score[u32_s];
+      u64_seen += j->au64_score[u32_s];
+      if (!u8_have50 && u64_seen * 2 >= u32_games) { u32_p50 = u32_s; u8_have50 = 1; }
+      if (!u8_have90 && u64_seen * 10 >= (uint64_t) u32_games * 9) { u32_p90 = u32_s; u8_have90 = 1; }
+      u32_max = u32_s;
+    }
+    
+    // fraction of games still going at a frame count
+    double adf_alive[3];
+    uint32_t au32_at[3] = {250, 500, 1000}, u32_i, u32_b;
+    for (u32_i = 0; u32_i < 3; u32_i++) {
+      uint64_t u64_dead = 0;
+      for (u32_b = 0; u32_b < u32_buckets && (u32_b + 1) * TUNER_BUCKET <= au32_at[u32_i]; u32_b++) {
+        u64_dead += j->pu64_death[u32_b];
+      }
+      adf_alive[u32_i] = au32_at[u32_i] > u32_maxFrames ? 0 : 1.0 - (double) u64_dead / u32_games;
+    }
+    
+    printf("%7.3f %5.2f %7d %7u %5u  %-16s %9u %6.2f %4u %4u %4u %7.1f  %9.4f %9.4f %10.4f\n",
+           j->tuning.f_gravity, j->tuning.f_flap, j->tuning.i8_gapHeight,
+           j->tuning.u8_gapSpacing, j->tuning.u8_gapRange, j->model->name,
+           u32_games, (double) u64_sum / u32_games, u32_p50, u32_p90, u32_max,
+           (double) j->u64_frames / u32_games, adf_alive[0], adf_alive[1], adf_alive[2]);
+    
+    // score survival curve: share of games that reached each score
+    if (u8_verbose) {
+      uint64_t u64_atLeast = u32_games;
+      printf("  reached score:");
+      for (u32_s = 0; u32_s <= u32_max; u32_s++) {
+        printf(" %u:%.4f", u32_s, (double) u64_atLeast / u32_games);
+        u64_atLeast -= j->au64_score[u32_s];
+      }
+      printf("\n");
+    }
+    u64_allFrames += j->u64_frames;
+  }
+  
+  double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  fprintf(stderr, "%u combinations, %llu games, %llu frames on %u threads in %.2f s "
+                  "(%.0f games/s)\n",
+          u32_nJobs, (unsigned long long) u32_nJobs * u32_games,
+          (unsigned long long) u64_allFrames, u32_workers, secs,
+          secs > 0 ? u32_nJobs * (double) u32_games / secs : 0);
+  return 0;
+}
@@ -29,10 +29,12 @@
 // PRIVATE FUNCTIONS ////////////////////////////
 static void ROTATE_LEFT(uint8_t* u8_data, uint8_t u8_shift);
 static void configSPI1(void);
+static void configSPI1Mode16(uint8_t u8_on);
 
 
 // VIDEO MEMORY MAP (504 bytes, 84x6) ///////////
 static uint8_t NOK_MEM[84][6];         // DATA
+static uint8_t NOK_OUT[6][84];         // LATCHED FOR THE LCD, IN SEND ORDER
 static uint8_t NOK_CX = 0, NOK_CY = 0; // INDEXES
 
 
@@ -173,17 +175,28 @@ char const NOK_LARGENUM[13][20] = {
  * Configure SPI1
  */
 static void configSPI1(void) {
-  SPI1CON1 = PRI_PRESCAL_1_1     | // 1:1 pri prescale
-             SEC_PRESCAL_6_1     | // 6:1 sec prescale
+  SPI1CON1 = compute_spi_prescale(FCY_NOW, NOK_SCK_HZ) |
              CLK_POL_ACTIVE_HIGH | // clock active high
              SPI_CKE_ON          | // out -> active to inactive
              SPI_MODE8_ON        | // 8-bit mode
              MASTER_ENABLE_ON;     // master mode
+  SPI1CON2 = SPI_ENH_BUFF_ENABLE;  // 8-deep FIFOs
+  SPI1STAT = SPI_SISEL_TX_COMPLETE; // interrupt once all is out
 
   //enable SPI mode
   SPI1STATbits.SPIEN = 1;  
 }
 
+/**
+ * Switches SPI1 between 8 and 16-bit frames
+ * The module is off for a moment, so the LCD must be deselected
+ */
+static void configSPI1Mode16(uint8_t u8_on) {
+  SPI1STATbits.SPIEN = 0;
+  SPI1CON1bits.MODE16 = u8_on;
+  SPI1STATbits.SPIEN = 1;
+}
+
 
 // INIT /////////////////////////////////////////
 /**
@@ -200,6 +213,22 @@ void CONFIG_NOK() {
   configSPI1();
 }
 
+/**
+ * Sets the SPI1 prescalers again after a change of FCY
+ * (setClockProfile), once the queue is out
+ * SPI1 is left on or off, as it was (the bus is shared)
+ */
+void NOK_RETUNE() {
+  uint8_t u8_on;
+  
+  NOK_SPI_FLUSH();
+  u8_on = SPI1STATbits.SPIEN;
+  SPI1STATbits.SPIEN = 0;
+  SPI1CON1 = (SPI1CON1 & PRI_PRESCAL_MASK & SEC_PRESCAL_MASK)
+             | compute_spi_prescale(FCY_NOW, NOK_SCK_HZ);
+  SPI1STATbits.SPIEN = u8_on;
+}
+
 /**
  * Initializes the LCD
  */
@@ -250,36 +279,85 @@ void NOK_CLEAR() {
 
 /**
  * Dumps video memory map to LCD
+ * One burst of 16-bit frames, two bytes each, and waits for it
  */
 void NOK_UPDATE() {
-  uint8_t i, j;
   NOK_CX = 0;
   NOK_CY = 0;
-  for (j = 0; j < 6; j++) { //Sends memory map to LCD
+  NOK_PRESENT();
+  
+  NOK_SPI_FLUSH();
+  configSPI1Mode16(1);
+  NOK_MODE_DATA();
+  NOK_CS_ENABLE();
+  writeBlockSPI1(&NOK_OUT[0][0], sizeof(NOK_OUT));
+  NOK_CS_DISABLE();
+  configSPI1Mode16(0);
+}
+
+/**
+ * Latches video memory for NOK_UPDATE_BANK
+ * Drawing can carry on into video memory while the latched
+ * frame goes out a bank at a time
+ */
+void NOK_PRESENT() {
+  uint8_t i, j;
+  for (j = 0; j < 6; j++) {
     for (i = 0; i < 84; i++) {
-      NOK_SPI_DATA(NOK_MEM[i][j]);
+      NOK_OUT[j][i] = NOK_MEM[i][j];
     }
   }
 }
 
+/**
+ * Dumps one bank (8 rows) of the latched frame to LCD
+ * Banks must be sent 0 to 5 in turn, like NOK_UPDATE does,
+ * so a long update can be split up
+ * One burst of 16-bit frames, like NOK_UPDATE, and waits for it
+ * (84 bytes, about 70 us at 10 MHz); the queue must be idle
+ */
+void NOK_UPDATE_BANK(uint8_t u8_bank) {
+  NOK_SPI_FLUSH();
+  configSPI1Mode16(1);
+  NOK_MODE_DATA();
+  NOK_CS_ENABLE();
+  writeBlockSPI1(NOK_OUT[u8_bank], sizeof(NOK_OUT[0]));
+  NOK_CS_DISABLE();
+  configSPI1Mode16(0);
+}
+
 // SPI DATA /////////////////////////////////////
 /**
- * Writes byte as command to LCD
+ * Queues byte as command to LCD
+ * The SPI1 interrupt sends it, setting D/C (SPI1_TX_DC_PIN) on the way;
+ * the LCD stays selected until NOK_SPI_FLUSH
  */
 void NOK_SPI_CMD(uint8_t byte) {
-  NOK_MODE_CMD();
   NOK_CS_ENABLE();
-  NOK_SPI(byte);
-  NOK_CS_DISABLE();
+  writeQueueSPI1(byte, SPI_TX_CMD);
 }
 
 /**
- * Writes byte as data to LCD
+ * Queues byte as data to LCD
  */
 void NOK_SPI_DATA(uint8_t byte) {
-  NOK_MODE_DATA();
   NOK_CS_ENABLE();
-  NOK_SPI(byte);
+  writeQueueSPI1(byte, SPI_TX_DATA);
+}
+
+/**
+ * @return 1, if every queued byte has gone out to the LCD
+ */
+uint8_t NOK_SPI_IDLE() {
+  return isIdleQueueSPI1();
+}
+
+/**
+ * Waits out the queue and deselects the LCD
+ * Call before handing the SPI1 pins to something else
+ */
+void NOK_SPI_FLUSH() {
+  while (!isIdleQueueSPI1()) doHeartbeat();
   NOK_CS_DISABLE();
 }
 
@@ -692,6 +770,22 @@ void NOK_CIRCLE(uint8_t x, uint8_t y, uint8_t radius, uint8_t fill, uint8_t colo
   } while (a <= b);
 }
 
+/**
+ * Draws a hollow circle in video memory
+ * @param x0 center X-coordinate
+ * @param y0 center Y-coordinate
+ * @param radius outer radius in px
+ * @param color 1 for ON, 0 for OFF
+ * @param thickness ring width in px
+ */
+void NOK_EMPTY_CIRCLE(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t color, uint8_t thickness) {
+  uint8_t u8_i;
+  
+  for (u8_i = 0; u8_i < thickness && u8_i <= radius; u8_i++) {
+    NOK_CIRCLE(x0, y0, radius - u8_i, 0, color);
+  }
+}
+
 /**
  * Draws a bitmap on the entire screen
  */
@@ -37,6 +37,7 @@
 #define NOK_RST  _LATB13   // NOKIA 5110 RST
 #define NOK_DC   _LATB12   // NOKIA 5110 D/C
 #define NOK_LED  _LATB6    // NOKIA 5110 LED
+#define NOK_SCK_HZ 10000000L // fastest SCK (FCY/6 at 60 MHz)
 
 #define NOK_MODE_CMD()      NOK_DC  = 0;
 #define NOK_MODE_DATA()     NOK_DC  = 1;
@@ -48,14 +49,19 @@
 
 // INIT
 void CONFIG_NOK();
+void NOK_RETUNE();
 void NOK_INIT();
 void NOK_CLEAR();
 void NOK_UPDATE();
+void NOK_PRESENT();
+void NOK_UPDATE_BANK(uint8_t u8_bank);
 
 
 // SPI DATA
 void NOK_SPI_CMD(uint8_t byte);
 void NOK_SPI_DATA(uint8_t byte);
+uint8_t NOK_SPI_IDLE();
+void NOK_SPI_FLUSH();
 void NOK_SPI(uint8_t byte);
 
 
@@ -29,27 +29,34 @@
 void player_dot_init(struct player_dot* pDot, int x, int y, float dx, float dy, int radius) {
   pDot->x = x;
   pDot->y = y;
+  pDot->px = x;
+  pDot->py = y;
   pDot->dx = dx;
   pDot->dy = dy;
   pDot->radius = radius;
 }
 
-#define GRAVITY 0.85;
-
 void player_dot_update(struct player_dot* pDot, int goUp) {
+  player_dot_update_tuned(pDot, goUp, PDOT_GRAVITY, PDOT_FLAP);
+}
+
+/**
+ * Physics step with gravity and flap speed passed in (for tuning)
+ */
+void player_dot_update_tuned(struct player_dot* pDot, int goUp, float gravity, float flap) {
   
   if (goUp == 1) {
     // if told to go up, negate gravity
     if (pDot->dy > 0) pDot->dy = 0;
-    pDot->dy = -2;
+    pDot->dy = flap;
   } else {
     // otherwise, gravity
-    pDot->dy += GRAVITY;
+    pDot->dy += gravity;
   }
 
   // don't allow to go past 0
   if (pDot->y - pDot->radius < 0) {
-    pDot->dy = GRAVITY;
+    pDot->dy = gravity;
   }
   
   // if too far down, stop
@@ -62,6 +69,10 @@ void player_dot_update(struct player_dot* pDot, int goUp) {
     pDot->dx = 0;
   }
   
+  // remember where we came from (swept collision)
+  pDot->px = pDot->x;
+  pDot->py = pDot->y;
+  
   // append changes
   pDot->y += pDot->dy;
   pDot->x += pDot->dx;
@@ -33,15 +33,21 @@
 static const uint8_t LCD_MAX_X = 84;
 static const uint8_t LCD_MAX_Y = 46;
 
+// default physics (float, so the host rounds like the PIC)
+#define PDOT_GRAVITY 0.85f
+#define PDOT_FLAP    -2.0f
+
 struct player_dot {
   float x, y;
   float dx, dy;
+  float px, py;  // x, y before the last update
   int radius;
 };
 
 void player_dot_init(struct player_dot* pDot, int x, int y, float dx, float dy, int radius);
 
-void player_dot_update();
+void player_dot_update(struct player_dot* pDot, int goUp);
+void player_dot_update_tuned(struct player_dot* pDot, int goUp, float gravity, float flap);
 
 #endif
 
@@ -0,0 +1,148 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Frame Profiler
+ **/
+
+#include "profile.h"
+
+// FILE SPECIFIC FUNCTIONS
+static void stat_reset(uint8_t u8_phase);
+
+// FILE SPECIFIC VARIABLES
+static uint16_t au16_frame[PROFILE_PHASES];   // this frame, per phase
+static uint16_t au16_min[PROFILE_PHASES];     // this window ...
+static uint16_t au16_max[PROFILE_PHASES];
+static uint32_t au32_sum[PROFILE_PHASES];
+static struct profile_stat aStats[PROFILE_PHASES]; // last full window
+static uint8_t u8_frames;                     // frames in this window
+static uint16_t u16_lap;                      // last lap (or start)
+static uint16_t u16_frameStart;
+static uint8_t u8_started;
+
+static void stat_reset(uint8_t u8_phase) {
+  au16_min[u8_phase] = 0xFFFF;
+  au16_max[u8_phase] = 0;
+  au32_sum[u8_phase] = 0;
+}
+
+/**
+ * Starts with nothing measured (the clock must be running:
+ * configTime32)
+ */
+void profile_init(void) {
+  profile_restart();
+}
+
+/**
+ * Drops the frame and window so far (say, before a new game)
+ */
+void profile_restart(void) {
+  uint8_t u8_i;
+  
+  for (u8_i = 0; u8_i < PROFILE_PHASES; u8_i++) {
+    au16_frame[u8_i] = 0;
+    stat_reset(u8_i);
+  }
+  u8_frames = 0;
+  u8_started = 0;
+}
+
+/**
+ * @return the time, in PROFILE_US() ticks (wraps every 0x10000)
+ */
+uint16_t profile_now(void) {
+  return micros() / PROFILE_TICK_US;
+}
+
+/**
+ * Starts timing the frame's work (laps count from here)
+ * The first call of a frame also starts its interval
+ */
+void profile_start(void) {
+  u16_lap = profile_now();
+  if (!u8_started) {
+    u16_frameStart = u16_lap;
+    u8_started = 1;
+  }
+}
+
+/**
+ * Charges the time since the last lap (or start) to a phase
+ * @param u8_phase PROFILE_CLEAR ... PROFILE_PHYSICS
+ */
+void profile_lap(uint8_t u8_phase) {
+  uint16_t u16_t = profile_now();
+  
+  au16_frame[u8_phase] += u16_t - u16_lap;
+  au16_frame[PROFILE_BUSY] += u16_t - u16_lap;
+  u16_lap = u16_t;
+}
+
+/**
+ * Charges time measured elsewhere to a phase (not counted as busy)
+ * @param u8_phase phase
+ * @param u16_ticks time, in PROFILE_US() ticks
+ */
+void profile_add(uint8_t u8_phase, uint16_t u16_ticks) {
+  au16_frame[u8_phase] += u16_ticks;
+}
+
+/**
+ * Ends the frame: each phase's total goes into the window, and the
+ * window is published every PROFILE_WINDOW frames
+ * The next frame's interval starts now
+ */
+void profile_frame(void) {
+  uint16_t u16_t = profile_now();
+  uint8_t u8_i;
+  
+  au16_frame[PROFILE_INTERVAL] = u16_t - u16_frameStart;
+  u16_frameStart = u16_t;
+  
+  for (u8_i = 0; u8_i < PROFILE_PHASES; u8_i++) {
+    u16_t = au16_frame[u8_i];
+    au16_frame[u8_i] = 0;
+    if (u16_t < au16_min[u8_i]) au16_min[u8_i] = u16_t;
+    if (u16_t > au16_max[u8_i]) au16_max[u8_i] = u16_t;
+    au32_sum[u8_i] += u16_t;
+  }
+  
+  if (++u8_frames < PROFILE_WINDOW) return;
+  for (u8_i = 0; u8_i < PROFILE_PHASES; u8_i++) {
+    aStats[u8_i].u16_min = au16_min[u8_i];
+    aStats[u8_i].u16_avg = au32_sum[u8_i] / PROFILE_WINDOW;
+    aStats[u8_i].u16_max = au16_max[u8_i];
+    stat_reset(u8_i);
+  }
+  u8_frames = 0;
+}
+
+/**
+ * @param u8_phase phase
+ * @return min/avg/max in PROFILE_US() ticks, over the last full window
+ *         (all 0 until there is one)
+ */
+const struct profile_stat* profile_stat(uint8_t u8_phase) {
+  return &aStats[u8_phase];
+}
@@ -0,0 +1,82 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Frame Profiler
+ * 
+ * Times the phases of a game frame with micros() (pic24_time.h), in
+ * PROFILE_TICK_US ticks, and keeps min/avg/max of each over the last
+ * PROFILE_WINDOW frames. A lap is a clock read and an add, so it
+ * stays in for production builds; PROFILE_OFF compiles the marks in
+ * game.c out (the host tools do, since only firmware has the clock).
+ * 
+ * A frame: profile_start(), then profile_lap() after each phase
+ * (a phase may come up more than once), then profile_frame().
+ **/
+
+#ifndef PROFILE_H
+#define	PROFILE_H
+
+#include "pic24_all.h"
+
+// phases
+#define PROFILE_CLEAR     0   // clearing video memory, the floor
+#define PROFILE_GAPS      1   // drawing the gaps
+#define PROFILE_PLAYER    2   // drawing the player (and ghost)
+#define PROFILE_TEXT      3   // drawing the score (and overlay)
+#define PROFILE_LCD       4   // latched to last byte out (not CPU)
+#define PROFILE_COLLISION 5
+#define PROFILE_PHYSICS   6   // moving and making gaps, the player
+#define PROFILE_BUSY      7   // CPU time: all of the above but LCD
+#define PROFILE_INTERVAL  8   // frame start to frame start
+#define PROFILE_PHASES    9
+
+#define PROFILE_WINDOW    16  // frames per min/avg/max
+#define PROFILE_TICK_US   4   // 16-bit ticks last 262 ms
+
+// ticks to microseconds
+#define PROFILE_US(ticks) ((uint32_t) (ticks) * PROFILE_TICK_US)
+
+#ifdef PROFILE_OFF
+#define PROFILE_START()
+#define PROFILE_LAP(u8_phase)
+#else
+#define PROFILE_START()       profile_start()
+#define PROFILE_LAP(u8_phase) profile_lap(u8_phase)
+#endif
+
+struct profile_stat {
+  uint16_t u16_min;
+  uint16_t u16_avg;
+  uint16_t u16_max;
+};
+
+void profile_init(void);
+void profile_restart(void);
+uint16_t profile_now(void);
+void profile_start(void);
+void profile_lap(uint8_t u8_phase);
+void profile_add(uint8_t u8_phase, uint16_t u16_ticks);
+void profile_frame(void);
+const struct profile_stat* profile_stat(uint8_t u8_phase);
+
+#endif	/* PROFILE_H */
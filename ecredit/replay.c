@@ -0,0 +1,219 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Input Recording & Playback
+ **/
+
+#include "replay.h"
+#include "eeprom.h"
+
+// FILE SPECIFIC FUNCTIONS
+static uint8_t unpack_header(struct replay *r, const uint8_t *pu8_buf);
+
+/**
+ * Header bytes, big endian like the EEPROM addresses
+ * @param r recording
+ * @param pu8_buf REPLAY_HEADER bytes
+ */
+void replay_header(const struct replay *r, uint8_t *pu8_buf) {
+  pu8_buf[0] = REPLAY_MAGIC >> 8;
+  pu8_buf[1] = REPLAY_MAGIC & 0xFF;
+  pu8_buf[2] = r->u16_seed >> 8;
+  pu8_buf[3] = r->u16_seed & 0xFF;
+  pu8_buf[4] = r->u16_frames >> 8;
+  pu8_buf[5] = r->u16_frames & 0xFF;
+  pu8_buf[6] = r->u8_score;
+  pu8_buf[7] = (r->u16_runs | (r->u8_truncated ? REPLAY_TRUNCATED : 0)) >> 8;
+  pu8_buf[8] = r->u16_runs & 0xFF;
+}
+
+/**
+ * Reads the header
+ * @return 1, if it is a recording; 0, if not
+ */
+static uint8_t unpack_header(struct replay *r, const uint8_t *pu8_buf) {
+  if (pu8_buf[0] != REPLAY_MAGIC >> 8 || pu8_buf[1] != (REPLAY_MAGIC & 0xFF)) return 0;
+  
+  r->u16_seed = ((uint16_t) pu8_buf[2] << 8) | pu8_buf[3];
+  r->u16_frames = ((uint16_t) pu8_buf[4] << 8) | pu8_buf[5];
+  r->u8_score = pu8_buf[6];
+  r->u16_runs = ((uint16_t) pu8_buf[7] << 8) | pu8_buf[8];
+  r->u8_truncated = (r->u16_runs & REPLAY_TRUNCATED) ? 1 : 0;
+  r->u16_runs &= ~REPLAY_TRUNCATED;
+  replay_play_start(r);
+  return r->u16_runs <= REPLAY_MAX_RUNS;
+}
+
+/**
+ * Starts an empty recording
+ * @param r recording
+ * @param u16_seed seed the game was started with
+ */
+void replay_record_start(struct replay *r, uint16_t u16_seed) {
+  r->u16_seed = u16_seed;
+  r->u16_frames = 0;
+  r->u8_score = 0;
+  r->u16_runs = 0;
+  r->u8_truncated = 0;
+}
+
+/**
+ * Adds one frame's input
+ * Once a frame needs a run the buffer has no room for, the recording
+ * is truncated: neither it nor any later frame is recorded, so what
+ * there is stays the start of the game
+ * @param r recording
+ * @param u8_pressed button state given to game_step
+ */
+void replay_record(struct replay *r, uint8_t u8_pressed) {
+  uint8_t *pu8_last;
+  u8_pressed = u8_pressed ? 0x80 : 0x00;
+  
+  if (r->u8_truncated) return;
+  
+  // grow the current run
+  if (r->u16_runs > 0) {
+    pu8_last = &r->au8_runs[r->u16_runs - 1];
+    if ((*pu8_last & 0x80) == u8_pressed && (*pu8_last & 0x7F) < REPLAY_MAX_RUN - 1) {
+      (*pu8_last)++;
+      r->u16_frames++;
+      return;
+    }
+  }
+  
+  // or start a new one
+  if (r->u16_runs == REPLAY_MAX_RUNS) {
+    r->u8_truncated = 1;
+    return;
+  }
+  r->au8_runs[r->u16_runs++] = u8_pressed;
+  r->u16_frames++;
+}
+
+/**
+ * Finishes a recording
+ * @param r recording
+ * @param u8_score final score, checked on playback (unless truncated)
+ */
+void replay_record_end(struct replay *r, uint8_t u8_score) {
+  r->u8_score = u8_score;
+}
+
+/**
+ * Rewinds a recording
+ */
+void replay_play_start(struct replay *r) {
+  r->u16_pos = 0;
+  r->u8_left = 0;
+  r->u16_played = 0;
+}
+
+/**
+ * Next frame's input; released after the end
+ * @param r recording
+ * @return 1, if pressed; 0, if released
+ */
+uint8_t replay_play(struct replay *r) {
+  if (r->u8_left == 0) {
+    if (r->u16_pos == r->u16_runs) return 0;
+    r->u8_left = (r->au8_runs[r->u16_pos++] & 0x7F) + 1;
+  }
+  r->u8_left--;
+  r->u16_played++;
+  return (r->au8_runs[r->u16_pos - 1] & 0x80) ? 1 : 0;
+}
+
+/**
+ * @return 1, if every recorded frame was played
+ */
+uint8_t replay_play_done(const struct replay *r) {
+  return r->u16_played >= r->u16_frames;
+}
+
+/**
+ * Serializes a recording (header, then runs)
+ * @param r recording
+ * @param pu8_buf REPLAY_HEADER + REPLAY_MAX_RUNS bytes
+ * @return bytes used
+ */
+uint16_t replay_pack(const struct replay *r, uint8_t *pu8_buf) {
+  replay_header(r, pu8_buf);
+  memcpy(pu8_buf + REPLAY_HEADER, r->au8_runs, r->u16_runs);
+  return REPLAY_HEADER + r->u16_runs;
+}
+
+/**
+ * Reads back a serialized recording
+ * @param r recording
+ * @param pu8_buf bytes from replay_pack
+ * @param u16_len bytes available
+ * @return 1, if it is a recording; 0, if not
+ */
+uint8_t replay_unpack(struct replay *r, const uint8_t *pu8_buf, uint16_t u16_len) {
+  if (u16_len < REPLAY_HEADER || !unpack_header(r, pu8_buf)) return 0;
+  if (REPLAY_HEADER + r->u16_runs > u16_len) return 0;
+  
+  memcpy(r->au8_runs, pu8_buf + REPLAY_HEADER, r->u16_runs);
+  return 1;
+}
+
+/**
+ * Stores a recording in EEPROM
+ * I2C1 has to be on
+ * @param r recording
+ * @param u16_addr where to put it (REPLAY_ADDR)
+ */
+void replay_save(const struct replay *r, uint16_t u16_addr) {
+  uint8_t au8_header[REPLAY_HEADER];
+  static const uint8_t u8_zero = 0x00;
+  
+  // runs first, so a half written recording has no valid magic
+  EEPROM_WRITE_BLOCK(u16_addr, &u8_zero, 1);
+  EEPROM_WRITE_BLOCK(u16_addr + REPLAY_HEADER, r->au8_runs, r->u16_runs);
+  
+  // the magic byte last
+  replay_header(r, au8_header);
+  EEPROM_WRITE_BLOCK(u16_addr + 1, &au8_header[1], REPLAY_HEADER - 1);
+  EEPROM_WRITE_BLOCK(u16_addr, &au8_header[0], 1);
+}
+
+/**
+ * Reads a recording from EEPROM
+ * I2C1 has to be on
+ * @param r recording
+ * @param u16_addr where it is (REPLAY_ADDR)
+ * @return 1, if there was one; 0, if not, or the chip stopped answering
+ */
+uint8_t replay_load(struct replay *r, uint16_t u16_addr) {
+  uint8_t au8_header[REPLAY_HEADER];
+  
+  // two sequential reads: the header, then the runs it counts
+  if (!EEPROM_READ_BLOCK(u16_addr, au8_header, REPLAY_HEADER)) return 0;
+  if (!unpack_header(r, au8_header)) return 0;
+  
+  if (!EEPROM_READ_BLOCK(u16_addr + REPLAY_HEADER, r->au8_runs, r->u16_runs)) {
+    r->u16_runs = 0;
+    return 0;
+  }
+  return 1;
+}
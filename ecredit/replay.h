@@ -0,0 +1,76 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Input Recording & Playback
+ * 
+ * A game is its seed plus the button state of every frame, so that is
+ * all a recording holds. Inputs are run-length coded, one byte a run:
+ * bit 7 is the button, bits 6-0 the run length - 1. A game that needs
+ * more than REPLAY_MAX_RUNS runs is recorded up to there, and marked
+ * truncated: its score can't be checked on playback.
+ **/
+
+#ifndef REPLAY_H
+#define	REPLAY_H
+
+#include "pic24_all.h"
+
+#define REPLAY_ADDR     0x4000  // recording of the last game, in EEPROM
+#define REPLAY_MAGIC    0x5250  // "RP"
+#define REPLAY_HEADER   9       // magic, seed, frames, score, runs
+#define REPLAY_MAX_RUNS 1024
+#define REPLAY_MAX_RUN  128
+#define REPLAY_TRUNCATED 0x8000 // in the header's runs: the game went on
+
+struct replay {
+  uint16_t u16_seed;
+  uint16_t u16_frames;    // inputs recorded
+  uint8_t u8_score;       // score the game ended with
+  uint16_t u16_runs;      // bytes of au8_runs used
+  uint8_t u8_truncated;   // the runs filled up before the game ended
+  uint8_t au8_runs[REPLAY_MAX_RUNS];
+  
+  // playback cursor
+  uint16_t u16_pos;
+  uint8_t u8_left;
+  uint16_t u16_played;
+};
+
+// RECORDING
+void replay_record_start(struct replay *r, uint16_t u16_seed);
+void replay_record(struct replay *r, uint8_t u8_pressed);
+void replay_record_end(struct replay *r, uint8_t u8_score);
+
+// PLAYBACK
+void replay_play_start(struct replay *r);
+uint8_t replay_play(struct replay *r);
+uint8_t replay_play_done(const struct replay *r);
+
+// STORAGE
+void replay_header(const struct replay *r, uint8_t *pu8_buf);
+uint16_t replay_pack(const struct replay *r, uint8_t *pu8_buf);
+uint8_t replay_unpack(struct replay *r, const uint8_t *pu8_buf, uint16_t u16_len);
+void replay_save(const struct replay *r, uint16_t u16_addr);
+uint8_t replay_load(struct replay *r, uint16_t u16_addr);
+
+#endif	/* REPLAY_H */
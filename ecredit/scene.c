@@ -0,0 +1,71 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Scenes
+ **/
+
+#include "scene.h"
+
+// FILE SPECIFIC VARIABLES
+static const struct scene *current = NULL;
+static const struct scene *pending = NULL;
+static uint16_t u16_ticks = 0;
+
+/**
+ * Switches scenes at the start of the next tick
+ * (exit of the old one, then enter of the new one)
+ * @param next scene to run
+ */
+void scene_set(const struct scene *next) {
+  pending = next;
+}
+
+/**
+ * Runs one tick of the current scene, switching first if asked to
+ */
+void scene_tick(void) {
+  // an enter hook may switch again, so loop
+  while (pending != current) {
+    if (current && current->exit) current->exit();
+    current = pending;
+    u16_ticks = 0;
+    if (current && current->enter) current->enter();
+  }
+  
+  if (current && current->tick) current->tick();
+  if (u16_ticks < 0xFFFF) u16_ticks++;
+}
+
+/**
+ * @return ticks since the current scene was entered (stops at 0xFFFF)
+ */
+uint16_t scene_ticks(void) {
+  return u16_ticks;
+}
+
+/**
+ * @return the current scene
+ */
+const struct scene* scene_current(void) {
+  return current;
+}
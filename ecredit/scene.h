@@ -0,0 +1,50 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Scenes
+ * 
+ * The program is a handful of scenes (boot, title, ready, ...), one of
+ * them current. Each has enter, tick and exit hooks, all optional, and
+ * none of them may block: main() calls scene_tick() once every
+ * SCENE_TICK_MS and a scene that waits just returns until it's time.
+ **/
+
+#ifndef SCENE_H
+#define	SCENE_H
+
+#include "pic24_all.h"
+
+#define SCENE_TICK_MS 4
+
+struct scene {
+  void (*enter)(void);
+  void (*tick)(void);
+  void (*exit)(void);
+};
+
+void scene_set(const struct scene *next);
+void scene_tick(void);
+uint16_t scene_ticks(void);
+const struct scene* scene_current(void);
+
+#endif	/* SCENE_H */
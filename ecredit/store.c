@@ -0,0 +1,568 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Record Store
+ **/
+
+#include "store.h"
+
+#define SEG_MAGIC   0xA5
+#define SEG_HEADER  7                       // magic, sequence, CRC
+#define REC_EXTRA   4                       // length, key, CRC
+#define REC_MAX     (STORE_MAX_VALUE + REC_EXTRA)
+#define SEG_ROOM    (STORE_SEGMENT - SEG_HEADER)
+#define SCAN_BUF    EEPROM_PAGE             // boot scan read-ahead
+
+#define SEG_ADDR(s) (STORE_ADDR + (uint16_t) (s) * STORE_SEGMENT)
+#define SEG_OF(a)   (((a) - STORE_ADDR) / STORE_SEGMENT)
+
+// what the write under way is
+#define WR_HEADER   0                       // a segment header
+#define WR_RECORD   1                       // a record
+#define WR_FREE     2                       // a segment's first byte, zeroed
+
+// FILE SPECIFIC FUNCTIONS
+static uint16_t CRC16(uint16_t u16_crc, const uint8_t *pu8_data, uint16_t u16_len);
+static uint16_t CRC_SEQ(uint32_t u32_seq);
+static uint8_t SCAN_BYTE(uint16_t u16_addr);
+static uint16_t SCAN_SEGMENT(uint8_t u8_seg);
+static void INDEX(uint8_t u8_key, uint16_t u16_addr, uint8_t u8_len);
+static uint8_t FITS(uint8_t u8_len);
+static void WRITE(uint8_t u8_kind, uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_len);
+static void WRITE_RECORD(uint8_t u8_key, const uint8_t *pu8_data, uint8_t u8_len);
+static void WRITE_HEADER(uint8_t u8_seg);
+static void WRITTEN(void);
+static uint8_t END(uint8_t u8_ok);
+static uint8_t NEXT_WRITE(void);
+static uint8_t START(uint8_t u8_key, const uint8_t *pu8_data, uint8_t u8_len);
+static uint8_t RUN(void);
+
+// FILE SPECIFIC VARIABLES
+static uint16_t au16_index[STORE_KEYS];  // newest record of each key, 0: none
+static uint8_t au8_len[STORE_KEYS];      // ... and its value's length
+static uint32_t au32_seq[STORE_SEGMENTS]; // sequence of each segment, 0: free
+static uint32_t u32_seqTop;              // the newest segment's
+static uint8_t u8_head;                  // newest segment
+static uint16_t u16_headEnd;             // where the next record goes
+static uint16_t u16_live;                // bytes of records in the index
+static uint8_t au8_rec[REC_MAX];         // a record being written or copied
+static uint8_t au8_scan[SCAN_BUF];
+static uint16_t u16_scanAddr;            // address of au8_scan[0]
+static uint8_t u8_scanLen;
+static uint8_t u8_unread;                // the boot scan failed: no operations
+static const uint8_t u8_free = 0x00;     // a free segment's first byte
+
+// the operation under way (a put, a delete, or finishing a compaction)
+static uint8_t u8_busy;
+static uint8_t u8_result;                // how the last one went
+static uint8_t u8_tries;                 // segments it has started
+static uint8_t u8_putKey;                // its record, or STORE_NONE
+static uint8_t u8_putLen;
+static uint8_t au8_put[STORE_MAX_VALUE];
+
+// ... and the write it is making, a page at a time
+static uint8_t u8_wrKind;                // WR_HEADER, WR_RECORD or WR_FREE
+static uint8_t u8_wrSeg;                 // segment, for WR_HEADER and WR_FREE
+static uint16_t u16_wrAddr;
+static const uint8_t *pu8_wr;
+static uint8_t u8_wrLen;
+static uint8_t u8_wrDone;                // bytes on the chip
+static uint8_t u8_wrStep;                // bytes in the piece store_step gave
+
+/**
+ * CRC-16/CCITT, carried on from u16_crc (0xFFFF to start)
+ */
+static uint16_t CRC16(uint16_t u16_crc, const uint8_t *pu8_data, uint16_t u16_len) {
+  uint8_t u8_bit;
+  
+  while (u16_len--) {
+    u16_crc ^= (uint16_t) *pu8_data++ << 8;
+    for (u8_bit = 0; u8_bit < 8; u8_bit++) {
+      u16_crc = (u16_crc & 0x8000) ? (u16_crc << 1) ^ 0x1021 : u16_crc << 1;
+    }
+  }
+  return u16_crc;
+}
+
+/**
+ * @return the CRC of a sequence number, where a record's CRC starts
+ */
+static uint16_t CRC_SEQ(uint32_t u32_seq) {
+  uint8_t au8_seq[4];
+  
+  au8_seq[0] = u32_seq;
+  au8_seq[1] = u32_seq >> 8;
+  au8_seq[2] = u32_seq >> 16;
+  au8_seq[3] = u32_seq >> 24;
+  return CRC16(0xFFFF, au8_seq, 4);
+}
+
+/**
+ * One byte of the boot scan, read ahead a page at a time
+ * A read that fails sets u8_unread (the byte is then 0xFF)
+ */
+static uint8_t SCAN_BYTE(uint16_t u16_addr) {
+  if (u8_scanLen == 0 || (uint16_t) (u16_addr - u16_scanAddr) >= u8_scanLen) {
+    u16_scanAddr = u16_addr;
+    u8_scanLen = (0x10000L - u16_addr < SCAN_BUF) ? 0x10000L - u16_addr : SCAN_BUF;
+    if (!EEPROM_READ_BLOCK(u16_scanAddr, au8_scan, u8_scanLen)) {
+      u8_unread = 1;
+      u8_scanLen = 0;
+      return 0xFF;
+    }
+  }
+  return au8_scan[u16_addr - u16_scanAddr];
+}
+
+/**
+ * Reads a segment's records into the index, in order, up to the first
+ * that doesn't check, or a read that fails (u8_unread)
+ * @return address past the last good record
+ */
+static uint16_t SCAN_SEGMENT(uint8_t u8_seg) {
+  uint16_t u16_base = SEG_ADDR(u8_seg);
+  uint16_t u16_off = SEG_HEADER;
+  uint16_t u16_seqCrc = CRC_SEQ(au32_seq[u8_seg]);
+  uint16_t u16_addr, u16_crc;
+  uint8_t u8_len, u8_key, u8_i;
+  
+  while (STORE_SEGMENT - u16_off >= REC_EXTRA) {
+    u16_addr = u16_base + u16_off;
+    u8_len = SCAN_BYTE(u16_addr);
+    u8_key = SCAN_BYTE(u16_addr + 1);
+    if (u8_len > STORE_MAX_VALUE || (u8_key & ~STORE_DELETED) >= STORE_KEYS) break;
+    if ((u8_key & STORE_DELETED) && u8_len != 0) break;
+    if (STORE_SEGMENT - u16_off < u8_len + REC_EXTRA) break;
+    
+    // the CRC, a byte at a time from the read-ahead
+    u16_crc = u16_seqCrc;
+    for (u8_i = 0; u8_i < u8_len + 2; u8_i++) {
+      au8_rec[0] = SCAN_BYTE(u16_addr + u8_i);
+      u16_crc = CRC16(u16_crc, au8_rec, 1);
+    }
+    if (SCAN_BYTE(u16_addr + u8_len + 2) != (uint8_t) u16_crc ||
+        SCAN_BYTE(u16_addr + u8_len + 3) != (uint8_t) (u16_crc >> 8)) break;
+    if (u8_unread) break;
+    
+    INDEX(u8_key, u16_addr, u8_len);
+    u16_off += u8_len + REC_EXTRA;
+  }
+  return u16_base + u16_off;
+}
+
+/**
+ * Points the index at a record, newer than the one it has for the key
+ * @param u8_key key, with STORE_DELETED for a delete
+ */
+static void INDEX(uint8_t u8_key, uint16_t u16_addr, uint8_t u8_len) {
+  uint8_t u8_k = u8_key & ~STORE_DELETED;
+  
+  if (au16_index[u8_k]) u16_live -= au8_len[u8_k] + REC_EXTRA;
+  if (u8_key & STORE_DELETED) {
+    au16_index[u8_k] = 0;
+  } else {
+    au16_index[u8_k] = u16_addr;
+    au8_len[u8_k] = u8_len;
+    u16_live += u8_len + REC_EXTRA;
+  }
+}
+
+/**
+ * @return 1, if a record with a value of u8_len bytes fits at the end
+ *         of the newest segment
+ */
+static uint8_t FITS(uint8_t u8_len) {
+  // (the end of the last segment is 0x10000, or 0)
+  return (uint16_t) (SEG_ADDR(u8_head) + STORE_SEGMENT - u16_headEnd) >= u8_len + REC_EXTRA;
+}
+
+/**
+ * Makes bytes the write under way, from their first
+ * @param u8_kind what they are, for WRITTEN: WR_HEADER, WR_RECORD or WR_FREE
+ */
+static void WRITE(uint8_t u8_kind, uint16_t u16_addr, const uint8_t *pu8_data, uint8_t u8_len) {
+  u8_wrKind = u8_kind;
+  u16_wrAddr = u16_addr;
+  pu8_wr = pu8_data;
+  u8_wrLen = u8_len;
+  u8_wrDone = 0;
+}
+
+/**
+ * Makes a record, for the end of the newest segment, the write under way
+ * @param u8_key key, with STORE_DELETED for a delete
+ */
+static void WRITE_RECORD(uint8_t u8_key, const uint8_t *pu8_data, uint8_t u8_len) {
+  uint16_t u16_crc;
+  
+  // length, key, value, CRC
+  au8_rec[0] = u8_len;
+  au8_rec[1] = u8_key;
+  if (u8_len) memmove(&au8_rec[2], pu8_data, u8_len);
+  u16_crc = CRC16(CRC_SEQ(u32_seqTop), au8_rec, u8_len + 2);
+  au8_rec[u8_len + 2] = u16_crc;
+  au8_rec[u8_len + 3] = u16_crc >> 8;
+  WRITE(WR_RECORD, u16_headEnd, au8_rec, u8_len + REC_EXTRA);
+}
+
+/**
+ * Makes the header of a (free) segment, the next in sequence, the
+ * write under way
+ */
+static void WRITE_HEADER(uint8_t u8_seg) {
+  uint16_t u16_crc;
+  uint32_t u32_seq = u32_seqTop + 1;
+  
+  au8_rec[0] = SEG_MAGIC;
+  au8_rec[1] = u32_seq;
+  au8_rec[2] = u32_seq >> 8;
+  au8_rec[3] = u32_seq >> 16;
+  au8_rec[4] = u32_seq >> 24;
+  u16_crc = CRC16(0xFFFF, au8_rec, 5);
+  au8_rec[5] = u16_crc;
+  au8_rec[6] = u16_crc >> 8;
+  WRITE(WR_HEADER, SEG_ADDR(u8_seg), au8_rec, SEG_HEADER);
+  u8_wrSeg = u8_seg;
+}
+
+/**
+ * Brings RAM up to date with a write that is all on the chip
+ */
+static void WRITTEN(void) {
+  switch (u8_wrKind) {
+    case WR_HEADER:
+      au32_seq[u8_wrSeg] = ++u32_seqTop;
+      u8_head = u8_wrSeg;
+      u16_headEnd = SEG_ADDR(u8_wrSeg) + SEG_HEADER;
+      break;
+    case WR_RECORD:
+      INDEX(au8_rec[1], u16_wrAddr, au8_rec[0]);
+      u16_headEnd += u8_wrLen;
+      break;
+    default:
+      au32_seq[u8_wrSeg] = 0;
+      break;
+  }
+}
+
+/**
+ * Ends the operation under way
+ * @return 0, for store_step
+ */
+static uint8_t END(uint8_t u8_ok) {
+  u8_busy = 0;
+  u8_result = u8_ok;
+  u8_wrLen = u8_wrDone = 0;
+  return 0;
+}
+
+/**
+ * Works out the operation's next write. First the segment after the
+ * newest, always kept free, is compacted, if it isn't free (a power
+ * loss or a failed write cut the last compaction short): its records
+ * still in the index are copied to the end of the newest, then its
+ * first byte is zeroed. Then the record goes at the end of the newest
+ * segment; if it doesn't fit, the free one is started first, which
+ * makes the one after it the next to compact
+ * @return 1, if there is a write; 0, if the operation is over
+ */
+static uint8_t NEXT_WRITE(void) {
+  uint8_t au8_value[STORE_MAX_VALUE];
+  uint8_t u8_seg = (u8_head + 1) % STORE_SEGMENTS;
+  uint8_t u8_key;
+  
+  if (au32_seq[u8_seg]) {
+    // a copied record's key points at the newest segment, so this
+    // finds the next one left
+    for (u8_key = 0; u8_key < STORE_KEYS; u8_key++) {
+      if (au16_index[u8_key] && SEG_OF(au16_index[u8_key]) == u8_seg) {
+        // a value that can't be read mustn't be copied under a new CRC;
+        // all of them fit, as long as the newest had a segment's room
+        if (!EEPROM_READ_BLOCK(au16_index[u8_key] + 2, au8_value, au8_len[u8_key])) return END(0);
+        if (!FITS(au8_len[u8_key])) return END(0);
+        WRITE_RECORD(u8_key, au8_value, au8_len[u8_key]);
+        return 1;
+      }
+    }
+    
+    // its deletes go with it: every record they hid was older still
+    WRITE(WR_FREE, SEG_ADDR(u8_seg), &u8_free, 1);
+    u8_wrSeg = u8_seg;
+    return 1;
+  }
+  
+  if (u32_seqTop && (u8_putKey == STORE_NONE || FITS(u8_putLen))) {
+    if (u8_putKey == STORE_NONE) return END(1);
+    WRITE_RECORD(u8_putKey, au8_put, u8_putLen);
+    u8_putKey = STORE_NONE;
+    return 1;
+  }
+  
+  // the newest is full, or there is none yet
+  if (++u8_tries > STORE_SEGMENTS) return END(0);
+  WRITE_HEADER(u8_seg);
+  return 1;
+}
+
+/**
+ * Starts an operation: a record to append, if any, after whatever
+ * compaction or new segment it takes
+ * @param u8_key key, with STORE_DELETED for a delete; STORE_NONE for
+ *        no record
+ * @return 1, if started; 0, if one is under way, or store_init
+ *         couldn't read the store (where the head ends isn't known)
+ */
+static uint8_t START(uint8_t u8_key, const uint8_t *pu8_data, uint8_t u8_len) {
+  if (u8_busy || u8_unread) return 0;
+  
+  u8_putKey = u8_key;
+  u8_putLen = u8_len;
+  if (u8_len) memcpy(au8_put, pu8_data, u8_len);
+  u8_tries = 0;
+  u8_wrLen = u8_wrDone = 0;
+  u8_busy = 1;
+  return 1;
+}
+
+/**
+ * Carries out the operation under way here, waiting out each write
+ * cycle
+ * @return 1, if done; 0, if the EEPROM stopped answering
+ */
+static uint8_t RUN(void) {
+  struct store_write w;
+  
+  while (store_step(&w)) {
+    store_step_done(EEPROM_WRITE_PAGE(w.u16_addr, w.pu8_data, w.u8_len) == w.u8_len &&
+                    EEPROM_WAIT_WRITE());
+  }
+  return u8_result;
+}
+
+/**
+ * Reads the segment headers, then each segment's records, oldest
+ * first, into the index; formats an empty area, and finishes a
+ * compaction a power loss cut short
+ * Waits out each write cycle, like store_put
+ * If a read fails, nothing is written: the store is left empty, and
+ * refuses every operation until a store_init that reads it all
+ * @return 1, if read (and anything left to finish written); 0, if the
+ *         EEPROM stopped answering
+ */
+uint8_t store_init(void) {
+  uint8_t au8_header[SEG_HEADER];
+  uint32_t u32_last = 0, u32_next;
+  uint8_t u8_seg, u8_next;
+  uint16_t u16_end = 0;
+  
+  memset(au16_index, 0, sizeof(au16_index));
+  u16_live = 0;
+  u32_seqTop = 0;
+  u8_head = 0;
+  u8_scanLen = 0;
+  u8_unread = 0;
+  u8_busy = 0;
+  
+  // headers
+  for (u8_seg = 0; u8_seg < STORE_SEGMENTS; u8_seg++) {
+    au32_seq[u8_seg] = 0;
+    if (!EEPROM_READ_BLOCK(SEG_ADDR(u8_seg), au8_header, SEG_HEADER)) u8_unread = 1;
+    if (u8_unread) continue;
+    if (au8_header[0] != SEG_MAGIC) continue;
+    if (CRC16(0xFFFF, au8_header, 5) != (au8_header[5] | (uint16_t) au8_header[6] << 8)) continue;
+    au32_seq[u8_seg] = au8_header[1] | (uint32_t) au8_header[2] << 8 |
+        (uint32_t) au8_header[3] << 16 | (uint32_t) au8_header[4] << 24;
+  }
+  
+  // records, oldest segment first; the newest is the head
+  while (1) {
+    u32_next = 0xFFFFFFFF;
+    u8_next = STORE_SEGMENTS;
+    for (u8_seg = 0; u8_seg < STORE_SEGMENTS; u8_seg++) {
+      if (au32_seq[u8_seg] > u32_last && au32_seq[u8_seg] <= u32_next) {
+        u32_next = au32_seq[u8_seg];
+        u8_next = u8_seg;
+      }
+    }
+    if (u8_next == STORE_SEGMENTS) break;
+    u16_end = SCAN_SEGMENT(u8_next);
+    if (u8_unread) break;
+    u8_head = u8_next;
+    u32_last = u32_seqTop = u32_next;
+  }
+  
+  // a part unread could hold newer records, or the head's end: a
+  // write (a new header over segment 0, or a record over live ones)
+  // would lose them, and a get could find an old value
+  if (u8_unread) {
+    memset(au16_index, 0, sizeof(au16_index));
+    u16_live = 0;
+    return 0;
+  }
+  
+  // nothing there yet: start at the first segment
+  if (u32_seqTop == 0) u8_head = STORE_SEGMENTS - 1;
+  u16_headEnd = u16_end;
+  START(STORE_NONE, NULL, 0);
+  return RUN();
+}
+
+/**
+ * Reads a key's value
+ * @param p_buf where to put it (up to u8_size bytes of it)
+ * @return its length, or STORE_NONE if there is no such key, or the
+ *         EEPROM stopped answering
+ */
+uint8_t store_get(uint8_t u8_key, void *p_buf, uint8_t u8_size) {
+  if (u8_key >= STORE_KEYS || !au16_index[u8_key]) return STORE_NONE;
+  
+  if (u8_size > au8_len[u8_key]) u8_size = au8_len[u8_key];
+  if (!EEPROM_READ_BLOCK(au16_index[u8_key] + 2, (uint8_t *) p_buf, u8_size)) return STORE_NONE;
+  return au8_len[u8_key];
+}
+
+/**
+ * Sets a key's value, in one record: after a power loss, a get finds
+ * either the old value or the new one
+ * Waits out each write cycle; starting a segment copies up to a
+ * segment's worth of records first (see store_put_start)
+ * @param u8_len up to STORE_MAX_VALUE bytes
+ * @return 1, if written; 0, if the key or length is out of range, the
+ *         store is full or unread (see store_init), an operation is
+ *         under way, or the EEPROM stopped answering
+ */
+uint8_t store_put(uint8_t u8_key, const void *p_data, uint8_t u8_len) {
+  return store_put_start(u8_key, p_data, u8_len) && RUN();
+}
+
+/**
+ * Removes a key (see store_put)
+ * @return 1, if it was there and is gone; 0, if not there, an
+ *         operation is under way, or the EEPROM stopped answering
+ */
+uint8_t store_delete(uint8_t u8_key) {
+  return store_delete_start(u8_key) && RUN();
+}
+
+/**
+ * Starts setting a key's value, as store_put, but leaves the writes to
+ * the caller: store_step hands them out
+ * The value is copied, so it needn't stay put
+ * @return 1, if started; 0, if the key or length is out of range, the
+ *         store is full or unread, or an operation is under way
+ */
+uint8_t store_put_start(uint8_t u8_key, const void *p_data, uint8_t u8_len) {
+  uint16_t u16_live_after;
+  
+  if (u8_key >= STORE_KEYS || u8_len > STORE_MAX_VALUE) return 0;
+  
+  u16_live_after = u16_live + u8_len + REC_EXTRA;
+  if (au16_index[u8_key]) u16_live_after -= au8_len[u8_key] + REC_EXTRA;
+  if (u16_live_after > store_capacity()) return 0;
+  
+  return START(u8_key, (const uint8_t *) p_data, u8_len);
+}
+
+/**
+ * Starts removing a key, as store_delete (see store_put_start)
+ * @return 1, if started; 0, if not there, or an operation is under way
+ */
+uint8_t store_delete_start(uint8_t u8_key) {
+  if (u8_key >= STORE_KEYS || !au16_index[u8_key]) return 0;
+  
+  return START(u8_key | STORE_DELETED, NULL, 0);
+}
+
+/**
+ * The next write of the operation under way, for the caller to make;
+ * the same one until store_step_done says how it went
+ * May read a record being compacted, so the bus must be on the EEPROM
+ * @param w gets the write (within one page)
+ * @return 1, if there is a write; 0, if the operation is over (or
+ *         there is none)
+ */
+uint8_t store_step(struct store_write *w) {
+  if (!u8_busy) return 0;
+  if (u8_wrDone == u8_wrLen && !NEXT_WRITE()) return 0;
+  
+  // up to the end of the page
+  u8_wrStep = EEPROM_PAGE - (u16_wrAddr + u8_wrDone) % EEPROM_PAGE;
+  if (u8_wrStep > u8_wrLen - u8_wrDone) u8_wrStep = u8_wrLen - u8_wrDone;
+  w->u16_addr = u16_wrAddr + u8_wrDone;
+  w->pu8_data = pu8_wr + u8_wrDone;
+  w->u8_len = u8_wrStep;
+  return 1;
+}
+
+/**
+ * Says how the write from store_step went
+ * @param u8_ok 1, if it is on the chip (its write cycle over); 0, if
+ *        the EEPROM stopped answering, which ends the operation (what
+ *        is on the chip is as a power loss would leave it)
+ */
+void store_step_done(uint8_t u8_ok) {
+  if (!u8_busy || u8_wrDone == u8_wrLen) return;
+  if (!u8_ok) {
+    END(0);
+    return;
+  }
+  
+  u8_wrDone += u8_wrStep;
+  if (u8_wrDone == u8_wrLen) WRITTEN();
+}
+
+/**
+ * @return 1, if an operation is under way
+ */
+uint8_t store_busy(void) {
+  return u8_busy;
+}
+
+/**
+ * For going through the keys in order:
+ *   for (k = store_next(0); k != STORE_NONE; k = store_next(k + 1))
+ * @return the first key from u8_key on that has a value, or STORE_NONE
+ */
+uint8_t store_next(uint8_t u8_key) {
+  for (; u8_key < STORE_KEYS; u8_key++) {
+    if (au16_index[u8_key]) return u8_key;
+  }
+  return STORE_NONE;
+}
+
+/**
+ * @return bytes taken by the records of the keys there are
+ */
+uint16_t store_live(void) {
+  return u16_live;
+}
+
+/**
+ * Live bytes allowed: enough segments are left over that the log
+ * always gets past a full one (a segment free, one being filled, and
+ * a record's worth lost at the end of each)
+ * @return the most store_live() can be
+ */
+uint16_t store_capacity(void) {
+  return (STORE_SEGMENTS - 2) * (SEG_ROOM - REC_MAX);
+}
@@ -0,0 +1,88 @@
+/* 
+ * Copyright (c) 2018 Jordan Stremming, Elisabeth Ama
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * Record Store
+ * 
+ * Small values by key, kept as a log in the upper 32 KB of the EEPROM
+ * (the ghost and the replay live below). The area is STORE_SEGMENTS
+ * segments used in turn, so every page sees the same wear:
+ *   segment  0xA5, sequence (4 bytes), CRC-16 of those 5
+ *   record   length, key, value, CRC-16 of the sequence and the rest
+ * A put or a delete (a record with STORE_DELETED set in its key and no
+ * value) is appended at the end of the newest segment. A record only
+ * counts once its CRC checks, so one cut off by a power loss leaves
+ * the old value; and since the CRC takes in its segment's sequence,
+ * records left over from a segment's last use never check.
+ * 
+ * store_init() reads the segments once, oldest first, into a RAM index
+ * of where each key's newest record is. When the newest segment is
+ * full, the next one (always kept free) is started and the oldest is
+ * compacted into it: its records still in the index are copied, then
+ * it is marked free (its first byte zeroed). A power loss on the way
+ * leaves copies that store_init() sorts out, and finishes the job. If
+ * it can't read it all, the store takes no writes until it can.
+ * 
+ * Everything is read and written with the eeprom.c primitives, so the
+ * caller must have the bus on the EEPROM. store_put and store_delete
+ * wait out each write cycle, and one that starts a segment writes up
+ * to a segment's worth of copies first. store_put_start and
+ * store_delete_start only start one: the caller makes each write
+ * store_step hands out (a page or less) and reports it with
+ * store_step_done, so it can yield while the chip programs. One
+ * operation at a time; the index only changes once a write is done.
+ **/
+
+#ifndef STORE_H
+#define	STORE_H
+
+#include "eeprom.h"
+
+#define STORE_ADDR      0x8000  // first byte (segment aligned)
+#define STORE_SEGMENTS  16
+#define STORE_SEGMENT   0x0800  // bytes per segment (32 pages)
+#define STORE_KEYS      32      // keys 0 to STORE_KEYS - 1
+#define STORE_MAX_VALUE 32      // bytes per value, at most
+#define STORE_NONE      0xFF    // store_get, store_next: no key
+#define STORE_DELETED   0x80    // key bit of a delete record
+
+// a write store_step hands out
+struct store_write {
+  uint16_t u16_addr;
+  const uint8_t *pu8_data;
+  uint8_t u8_len;               // within one page
+};
+
+uint8_t store_init(void);
+uint8_t store_get(uint8_t u8_key, void *p_buf, uint8_t u8_size);
+uint8_t store_put(uint8_t u8_key, const void *p_data, uint8_t u8_len);
+uint8_t store_delete(uint8_t u8_key);
+uint8_t store_put_start(uint8_t u8_key, const void *p_data, uint8_t u8_len);
+uint8_t store_delete_start(uint8_t u8_key);
+uint8_t store_step(struct store_write *w);
+void store_step_done(uint8_t u8_ok);
+uint8_t store_busy(void);
+uint8_t store_next(uint8_t u8_key);
+uint16_t store_live(void);
+uint16_t store_capacity(void);
+
+#endif	/* STORE_H */
@@ -0,0 +1,79 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  Top-level header of the ESOS subset in this library: the scheduler
+ *  and the system tick. See esos_task.h for writing tasks.
+ *
+ *  ESOS owns main(): it calls user_init(), which configures the
+ *  hardware and registers the tasks, starts the system tick and then
+ *  runs every registered task in turn, forever. A program that wants
+ *  its own main() (a host simulation, say) defines \c ESOS_USER_MAIN
+ *  and calls esos_Init() and esos_RunPass() itself.
+ *
+ *  The tick itself comes from four hardware hooks, implemented by
+ *  esos_pic24_tick.c on the PIC (Timer1, 1 ms) or by a host stand-in;
+ *  after a change of clock (setClockProfile()),
+ *  __esos_hw_RetuneSystemTick() keeps the tick at 1 ms.
+ *  Between passes the idle hook puts the core in Idle until the next
+ *  interrupt (the tick, at the latest); idleUntilTick() and sleepMs()
+ *  do the same for code that has to wait outside a task.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esos_task.h"
+
+/** Milliseconds per system tick. */
+#define ESOS_TICK_MS 1
+
+// Provided by the application.
+void user_init(void);
+
+// Scheduler.
+ESOS_TASK_HANDLE esos_RegisterTask(uint8_t (*taskname)(ESOS_TASK_HANDLE));
+uint8_t esos_UnregisterTask(uint8_t (*taskname)(ESOS_TASK_HANDLE));
+uint8_t esos_GetNumberRegisteredTasks(void);
+void esos_Init(void);
+void esos_RunPass(void);
+void idleUntilTick(uint32_t u32_tick);
+void sleepMs(uint16_t u16_ms);
+
+/** System ticks (ms) since the tick was started. */
+#define esos_GetSystemTick() __esos_hw_GetSystemTickCount()
+
+// Hardware hooks.
+void __esos_hw_InitSystemTick(void);
+void __esos_hw_RetuneSystemTick(void);
+uint32_t __esos_hw_GetSystemTickCount(void);
+void __esos_hw_Idle(void);
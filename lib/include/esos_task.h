@@ -0,0 +1,128 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  A small, source-compatible subset of ESOS tasks (see \ref ESOS):
+ *  stackless, cooperatively scheduled tasks in the style of
+ *  protothreads. A task is a function that returns each time it waits;
+ *  the next call resumes it where it left off.
+ *
+ *  Because a task's stack frame is gone after every wait, locals do not
+ *  survive an ESOS_TASK_WAIT_xxx or ESOS_TASK_YIELD; use \c static
+ *  variables for anything that must. A task also can't wait inside a
+ *  \c switch statement of its own, since the resume points are cases of
+ *  a \c switch that ESOS_TASK_BEGIN opens.
+ *
+ *  \code
+ *  ESOS_USER_TASK(blink) {
+ *    ESOS_TASK_BEGIN();
+ *    while (1) {
+ *      toggleHeartbeat();
+ *      ESOS_TASK_WAIT_TICKS(500);
+ *    }
+ *    ESOS_TASK_END();
+ *  }
+ *  \endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** Most tasks that can be registered at once. */
+#ifndef MAX_NUM_USER_TASKS
+# define MAX_NUM_USER_TASKS 8
+#endif
+
+/** Returned by a task that is waiting (it will be called again). */
+#define ESOS_TASK_WAITING 0
+/** Returned by a task that has finished (it is unregistered). */
+#define ESOS_TASK_ENDED   3
+
+/** State the scheduler keeps for each task. */
+typedef struct stTask {
+  uint16_t u16_lc;                         //!< resume point (a line number), 0 at the start
+  uint8_t (*pfn)(struct stTask *pst);      //!< the task function
+  uint32_t u32_savedTick;                  //!< deadline of ESOS_TASK_WAIT_TICKS
+} ESOS_TASK_CTRL;
+
+/** Handle of a registered task. */
+typedef ESOS_TASK_CTRL* ESOS_TASK_HANDLE;
+
+/** Declares (or defines) a task function called \em taskname. */
+#define ESOS_USER_TASK(taskname) uint8_t taskname(ESOS_TASK_HANDLE __pstSelf)
+
+/** Handle of the task that is running. Only valid inside a task. */
+#define ESOS_TASK_GET_TASK_HANDLE() (__pstSelf)
+
+/** Must be the first statement of a task. */
+#define ESOS_TASK_BEGIN() switch (__pstSelf->u16_lc) { case 0:
+
+/** Must be the last statement of a task. The task is unregistered when it gets here. */
+#define ESOS_TASK_END()                                                  \
+  }                                                                      \
+  __pstSelf->u16_lc = 0;                                                 \
+  return ESOS_TASK_ENDED
+
+/** Ends the task right away (it is unregistered). */
+#define ESOS_TASK_EXIT()                                                 \
+  do {                                                                   \
+    __pstSelf->u16_lc = 0;                                               \
+    return ESOS_TASK_ENDED;                                              \
+  } while (0)
+
+/** Lets every other task run once before this one continues. */
+#define ESOS_TASK_YIELD()                                                \
+  do {                                                                   \
+    __pstSelf->u16_lc = __LINE__;                                        \
+    return ESOS_TASK_WAITING;                                            \
+    case __LINE__:;                                                      \
+  } while (0)
+
+/** Yields until \em cond is true (checked once per scheduler pass). */
+#define ESOS_TASK_WAIT_UNTIL(cond)                                       \
+  do {                                                                   \
+    __pstSelf->u16_lc = __LINE__;                                        \
+    case __LINE__:                                                       \
+    if (!(cond)) return ESOS_TASK_WAITING;                               \
+  } while (0)
+
+/** Yields while \em cond is true. */
+#define ESOS_TASK_WAIT_WHILE(cond) ESOS_TASK_WAIT_UNTIL(!(cond))
+
+/** Yields for at least \em u32_duration system ticks (ms). */
+#define ESOS_TASK_WAIT_TICKS(u32_duration)                               \
+  do {                                                                   \
+    __pstSelf->u32_savedTick = esos_GetSystemTick() + (u32_duration);    \
+    ESOS_TASK_WAIT_UNTIL((int32_t) (esos_GetSystemTick() -               \
+                                    __pstSelf->u32_savedTick) >= 0);     \
+  } while (0)
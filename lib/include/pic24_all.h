@@ -59,6 +59,7 @@
 #endif
 
 #include "pic24_timer.h"
+#include "pic24_time.h"
 #include "pic24_i2c.h"
 #include "pic24_spi.h"
 #include "pic24_adc.h"
@@ -337,6 +337,37 @@
  */
 #define CYCLES_PER_US ((uint32_t)(FCY * 0.000001))
 
+///@{ \name Clock profiles
+/** Run at \ref CLOCK_CONFIG. */
+#define CLOCK_PROFILE_FULL 0
+/** Run from the FRC, without the PLL, at \ref CLOCK_LOW_FCY. */
+#define CLOCK_PROFILE_LOW  1
+
+/** The processor clock frequency of \ref CLOCK_PROFILE_LOW. */
+#if defined(__PIC24F__) || defined(__PIC24FK__)
+# define CLOCK_LOW_FCY 4000000L
+#else
+# define CLOCK_LOW_FCY 3685000L
+#endif
+
+#if USE_CLOCK_PROFILES
+extern uint32_t u32_fcy;
+/** The processor clock frequency right now: \ref FCY, or
+ *  \ref CLOCK_LOW_FCY after setClockProfile(CLOCK_PROFILE_LOW).
+ *  Code that sets up a peripheral clock from FCY should use this.
+ */
+# define FCY_NOW (u32_fcy)
+#else
+# define FCY_NOW (FCY)
+#endif
+
+/** Processor clock cycles in 1 millisecond at \ref FCY_NOW. */
+#define CYCLES_PER_MS_NOW ((uint32_t)(FCY_NOW / 1000L))
+
+/** Processor clock cycles in 1 microsecond at \ref FCY_NOW. */
+#define CYCLES_PER_US_NOW ((uint32_t)(FCY_NOW / 1000000L))
+///@}
+
 
 ///@{ \name Helper macros for clock configuration
 /** A helper macro to check if the given clock configuration
@@ -440,6 +471,11 @@ void configClockPRI_8MHzCrystal_4MHzFCY(void);
 
 /// @}
 
+#if USE_CLOCK_PROFILES
+void setClockProfile(uint8_t u8_profile);
+uint8_t getClockProfile(void);
+#endif
+
 /** Configure the default clock by calling the
  *  \ref CONFIG_DEFAULT_CLOCK() macro.
  */
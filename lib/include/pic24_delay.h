@@ -54,7 +54,7 @@
  */
 inline static void delayAndUpdateHeartbeatCount(uint32_t u32_cyc) {
   __delay32(u32_cyc);
-#if USE_HEARTBEAT
+#if USE_HEARTBEAT && !USE_HEARTBEAT_TICK
   u32_heartbeatCount += (u32_cyc >> 4);
 #endif
 }
@@ -68,10 +68,10 @@ inline static void delayAndUpdateHeartbeatCount(uint32_t u32_cyc) {
  *  to delay.
  * \param ms The number of milliseconds to delay.
  */
-#define DELAY_MS(ms)  delayAndUpdateHeartbeatCount(CYCLES_PER_MS * ((uint32_t) (ms)));
+#define DELAY_MS(ms)  delayAndUpdateHeartbeatCount(CYCLES_PER_MS_NOW * ((uint32_t) (ms)));
 
 /** A macro to delay the given number of microseconds.
  *  \see \ref DELAY_MS for additional information.
  * \param us The number of microseconds to delay.
  */
-#define DELAY_US(us)  delayAndUpdateHeartbeatCount(CYCLES_PER_US * ((uint32_t) (us)));
+#define DELAY_US(us)  delayAndUpdateHeartbeatCount(CYCLES_PER_US_NOW * ((uint32_t) (us)));
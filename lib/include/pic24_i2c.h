@@ -62,6 +62,42 @@
 #define I2C_WADDR(x) (x & 0xFE) //clear R/W bit of I2C addr
 #define I2C_RADDR(x) (x | 0x01) //set R/W bit of I2C addr
 
+/* I2C_STEP operations */
+#define I2C_OP_START  0   ///< start; a repeated start if not the first step
+#define I2C_OP_WRITE  1   ///< write u16_len bytes (a NAK ends the transaction)
+#define I2C_OP_READ   2   ///< read u16_len bytes, NAKing the last
+#define I2C_OP_STOP   3
+
+/* I2C_XFER status */
+#define I2C_XFER_OK       0
+#define I2C_XFER_NAK      1   ///< a write got a NAK (a stop was sent)
+#define I2C_XFER_PENDING  2   ///< queued, or running
+#define I2C_XFER_TIMEOUT  3   ///< the bus stuck, or collided (it was recovered, or should be)
+
+/* tryXxxI2Cx() result, besides I2C_ACK and I2C_NAK */
+#define I2C_TIMEOUT 2
+
+/** Longest a tryXxxI2Cx() operation waits on the bus, in microseconds. */
+#ifndef I2C_TIMEOUT_US
+# define I2C_TIMEOUT_US 1000
+#endif
+
+/** One step of a queued I2C transaction. */
+typedef struct {
+  uint8_t u8_op;        ///< I2C_OP_START, I2C_OP_WRITE, I2C_OP_READ or I2C_OP_STOP
+  uint8_t* pu8_data;    ///< bytes to write, or where to read them to
+  uint16_t u16_len;     ///< number of bytes
+} I2C_STEP;
+
+/** A queued I2C transaction: see queueI2C1(). */
+typedef struct I2C_XFER {
+  const I2C_STEP* pst_steps;
+  uint8_t u8_steps;
+  void (*pfn_done)(struct I2C_XFER* pst_xfer); ///< called when it's over (or NULL)
+  void* p_arg;                                ///< for the callback
+  volatile uint8_t u8_status;                 ///< I2C_XFER_PENDING until it's over
+} I2C_XFER;
+
 
 //I2C Operations
 void configI2C1(uint16_t u16_FkHZ);
@@ -71,6 +107,12 @@ void stopI2C1(void);
 void putI2C1(uint8_t u8_val);
 uint8_t putNoAckCheckI2C1(uint8_t u8_val);
 uint8_t getI2C1(uint8_t u8_ack2Send);
+uint8_t tryStartI2C1(void);
+uint8_t tryRstartI2C1(void);
+uint8_t tryStopI2C1(void);
+uint8_t tryPutI2C1(uint8_t u8_val);
+uint8_t tryGetI2C1(uint8_t u8_ack2Send, uint8_t* pu8_byte);
+void recoverI2C1(void);
 
 //I2C Transactions
 void write1I2C1(uint8_t u8_addr,uint8_t u8_d1);
@@ -80,6 +122,11 @@ void read1I2C1(uint8_t u8_addr,uint8_t* pu8_d1);
 void read2I2C1(uint8_t u8_addr,uint8_t* pu8_d1, uint8_t* pu8_d2);
 void readNI2C1(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt);
 
+//I2C Queued transactions
+uint8_t queueI2C1(I2C_XFER* pst_xfer);
+uint8_t isIdleQueueI2C1(void);
+void abortQueueI2C1(void);
+
 #endif // #if (NUM_I2C_MODS >= 1)
 
 
@@ -159,6 +206,12 @@ void stopI2C2(void);
 void putI2C2(uint8_t u8_val);
 uint8_t putNoAckCheckI2C2(uint8_t u8_val);
 uint8_t getI2C2(uint8_t u8_ack2Send);
+uint8_t tryStartI2C2(void);
+uint8_t tryRstartI2C2(void);
+uint8_t tryStopI2C2(void);
+uint8_t tryPutI2C2(uint8_t u8_val);
+uint8_t tryGetI2C2(uint8_t u8_ack2Send, uint8_t* pu8_byte);
+void recoverI2C2(void);
 
 //I2C Transactions
 void write1I2C2(uint8_t u8_addr,uint8_t u8_d1);
@@ -168,6 +221,11 @@ void read1I2C2(uint8_t u8_addr,uint8_t* pu8_d1);
 void read2I2C2(uint8_t u8_addr,uint8_t* pu8_d1, uint8_t* pu8_d2);
 void readNI2C2(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt);
 
+//I2C Queued transactions
+uint8_t queueI2C2(I2C_XFER* pst_xfer);
+uint8_t isIdleQueueI2C2(void);
+void abortQueueI2C2(void);
+
 #endif // #if (NUM_I2C_MODS >= 2)
 
 
@@ -341,6 +341,15 @@
 # endif
 #endif
 
+/** When set to 1, setClockProfile() can move the core between
+ *  \ref CLOCK_CONFIG and the bare FRC at run time, and \ref FCY_NOW
+ *  (used by the delays, the UART/I2C baud rate setup and the timer
+ *  conversions) follows it. When 0, FCY_NOW is simply \ref FCY.
+ */
+#ifndef USE_CLOCK_PROFILES
+# define USE_CLOCK_PROFILES (0)
+#endif
+
 /* \name Heartbeat
  *  These routines provide heartbeat support by blinking a LED
  *  on a regular basis. See doHeartbeat() for more information.
@@ -355,6 +364,21 @@
 #endif
 
 
+#ifndef USE_HEARTBEAT_TICK
+/** If this macro is true, the ESOS system tick (esos_pic24_tick.c)
+ *  toggles the heartbeat LED every \ref HEARTBEAT_TICK_MS, so it keeps
+ *  time while the core idles, and doHeartbeat() does nothing.
+ *  If false, doHeartbeat() counts calls, as in any blocking wait loop.
+ */
+# define USE_HEARTBEAT_TICK (0)
+#endif
+
+#ifndef HEARTBEAT_TICK_MS
+/** Heartbeat half period, in ms, when \ref USE_HEARTBEAT_TICK is true. */
+# define HEARTBEAT_TICK_MS (250)
+#endif
+
+
 #ifndef HB_LED
 # if (HARDWARE_PLATFORM == EXPLORER16_100P)
 #   define HB_LED _LATA7
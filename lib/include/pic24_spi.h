@@ -80,6 +80,9 @@ specified in the MPLAB C30/src/peripheral_24F/spi.h header.
 #define  SPI_IDLE_CON           0x0000 /* Continue module operation in idle mode */
 #define  SPI_IDLE_MASK          (~SPI_IDLE_STOP)
 
+#define  SPI_SISEL_TX_COMPLETE  0x0014 /* Interrupt when the last bit is shifted out (enhanced buffer mode) */
+#define  SPI_SISEL_MASK         (~0x001c)
+
 #define  SPI_RX_OVFLOW          0x0040
 #define  SPI_RX_OVFLOW_CLR      0x0000 /* Clear receive overflow bit */
 
@@ -104,12 +107,24 @@ specified in the MPLAB C30/src/peripheral_24F/spi.h header.
 #define  SPI_ENH_BUFF_DISABLE   0x0000 /* disable enhanced buffer */
 #define  SPI_ENH_BUFF_MASK      (~SPI_ENH_BUFF_ENABLE)
 
+/* writeQueueSPIx tags */
+#define  SPI_TX_CMD             0      /* SPIx_TX_DC_PIN low */
+#define  SPI_TX_DATA            1      /* SPIx_TX_DC_PIN high */
+
+uint16_t compute_spi_prescale(uint32_t u32_fcy, uint32_t u32_sckHz);
+
 // Only include if this UART exists.
 #if (NUM_SPI_MODS >= 1)
 uint16_t ioMasterSPI1(uint16_t u16_c);
+void writeBlockSPI1(const uint8_t *pu8_data, uint16_t u16_len);
+void writeQueueSPI1(uint8_t u8_c, uint8_t u8_tag);
+uint8_t isIdleQueueSPI1(void);
 #endif
 
 
 #if (NUM_SPI_MODS >= 2)
 uint16_t ioMasterSPI2(uint16_t u16_c);
+void writeBlockSPI2(const uint8_t *pu8_data, uint16_t u16_len);
+void writeQueueSPI2(uint8_t u8_c, uint8_t u8_tag);
+uint8_t isIdleQueueSPI2(void);
 #endif
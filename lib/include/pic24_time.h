@@ -0,0 +1,94 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  A monotonic clock: Timer2 and Timer3 cascaded into one 32-bit
+ *  timer, free running at FCY, with micros() and millis() to read it.
+ *
+ *  The timer's period is one second (FCY ticks); its interrupt moves
+ *  the clock on by that second, and the reads add the ticks into the
+ *  current one. A read holds the Timer3 interrupt off, and checks its
+ *  flag, so it can't get the second from one side of an overflow and
+ *  the ticks from the other. Call them from main line code or from an
+ *  interrupt of no higher priority than \ref TIME32_INTERRUPT_PRIORITY.
+ *
+ *  micros() wraps every 71.6 minutes and millis() every 49.7 days;
+ *  compare times with the deadline helpers below (or the same signed
+ *  subtraction), never with < or >.
+ *
+ *  With \ref USE_CLOCK_PROFILES, call retuneTime32() after each
+ *  setClockProfile(): it counts the ticks so far at the old speed, then
+ *  starts a new second at the new one.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "pic24_chip.h"
+#include "pic24_clockfreq.h"
+
+/** Priority of the Timer3 (once a second) interrupt. */
+#ifndef TIME32_INTERRUPT_PRIORITY
+# define TIME32_INTERRUPT_PRIORITY 1
+#endif
+
+void configTime32(void);
+void retuneTime32(void);
+uint32_t micros(void);
+uint32_t millis(void);
+
+/** \return micros() \em u32_us from now, as a deadline. */
+static inline uint32_t deadlineUs(uint32_t u32_us) {
+  return micros() + u32_us;
+}
+
+/** \return Microseconds since \em u32_start, a micros() time up to
+ *  71 minutes ago.
+ */
+static inline uint32_t elapsedUs(uint32_t u32_start) {
+  return micros() - u32_start;
+}
+
+/** \return 1 if the micros() deadline \em u32_deadline has passed
+ *  (or is now), else 0. Deadlines up to 35 minutes out work.
+ */
+static inline uint8_t isDeadlinePassed(uint32_t u32_deadline) {
+  return (int32_t) (micros() - u32_deadline) >= 0;
+}
+
+/** \return Microseconds left until the micros() deadline
+ *  \em u32_deadline, or 0 once it has passed.
+ */
+static inline uint32_t usUntil(uint32_t u32_deadline) {
+  int32_t i32_left = (int32_t) (u32_deadline - micros());
+  return i32_left > 0 ? (uint32_t) i32_left : 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  ESOS scheduler: a round robin over the registered tasks.
+ */
+
+#include "esos.h"
+#include <stddef.h>        // To define NULL
+
+static ESOS_TASK_CTRL ast_tasks[MAX_NUM_USER_TASKS];
+static uint8_t u8_numTasks;
+
+/** Adds a task; it starts running on the next scheduler pass.
+ *  \param taskname Task function, defined with ESOS_USER_TASK
+ *  \return Handle of the task, or NULL if MAX_NUM_USER_TASKS are
+ *          already registered.
+ */
+ESOS_TASK_HANDLE esos_RegisterTask(uint8_t (*taskname)(ESOS_TASK_HANDLE)) {
+  ESOS_TASK_HANDLE pst_task;
+
+  if (u8_numTasks == MAX_NUM_USER_TASKS) return NULL;
+  pst_task = &ast_tasks[u8_numTasks++];
+  pst_task->u16_lc = 0;
+  pst_task->pfn = taskname;
+  pst_task->u32_savedTick = 0;
+  return pst_task;
+}
+
+/** Removes a task.
+ *  \param taskname Task function given to esos_RegisterTask
+ *  \return 1 if it was registered, else 0.
+ */
+uint8_t esos_UnregisterTask(uint8_t (*taskname)(ESOS_TASK_HANDLE)) {
+  uint8_t u8_i;
+
+  for (u8_i = 0; u8_i < u8_numTasks; u8_i++) {
+    if (ast_tasks[u8_i].pfn == taskname) {
+      // keep the others in order
+      for (u8_numTasks--; u8_i < u8_numTasks; u8_i++) {
+        ast_tasks[u8_i] = ast_tasks[u8_i + 1];
+      }
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/** \return Number of tasks registered. */
+uint8_t esos_GetNumberRegisteredTasks(void) {
+  return u8_numTasks;
+}
+
+/** Calls user_init(), then starts the system tick. */
+void esos_Init(void) {
+  user_init();
+  __esos_hw_InitSystemTick();
+}
+
+/** Runs each registered task once, in the order they were registered,
+ *  then calls the idle hook.
+ */
+void esos_RunPass(void) {
+  uint8_t u8_i;
+
+  for (u8_i = 0; u8_i < u8_numTasks; u8_i++) {
+    if (ast_tasks[u8_i].pfn(&ast_tasks[u8_i]) == ESOS_TASK_ENDED) {
+      esos_UnregisterTask(ast_tasks[u8_i].pfn);
+      u8_i--;
+    }
+  }
+  __esos_hw_Idle();
+}
+
+/** Idles the core until the system tick reaches \em u32_tick. Any
+ *  interrupt wakes it early, to check again; tasks don't run meanwhile.
+ *  \param u32_tick Tick to wait for (a past tick returns at once)
+ */
+void idleUntilTick(uint32_t u32_tick) {
+  while ((int32_t) (esos_GetSystemTick() - u32_tick) < 0) {
+    __esos_hw_Idle();
+  }
+}
+
+/** Idles the core for \em u16_ms, to within a tick, instead of spinning
+ *  like DELAY_MS(). Needs the system tick running.
+ *  \param u16_ms Milliseconds to wait
+ */
+void sleepMs(uint16_t u16_ms) {
+  idleUntilTick(esos_GetSystemTick() + (u16_ms + ESOS_TICK_MS - 1) / ESOS_TICK_MS);
+}
+
+#ifndef ESOS_USER_MAIN
+int main(void) {
+  esos_Init();
+  while (1) {
+    esos_RunPass();
+  }
+}
+#endif
@@ -0,0 +1,106 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  ESOS system tick for the PIC24/dsPIC33: Timer1 interrupts once per
+ *  ms and counts. Timer1 keeps running in Idle, so the tick is what
+ *  wakes the core from __esos_hw_Idle() if nothing else does. With
+ *  \ref USE_HEARTBEAT_TICK, the tick also blinks the heartbeat LED.
+ */
+
+#include "pic24_all.h"
+#include "esos.h"
+
+#ifndef ESOS_TICK_INTERRUPT_PRIORITY
+# define ESOS_TICK_INTERRUPT_PRIORITY 1
+#endif
+
+static volatile uint32_t u32_tickCount;
+#if USE_HEARTBEAT && USE_HEARTBEAT_TICK
+static uint16_t u16_heartbeatMs;
+#endif
+
+void _ISR _T1Interrupt(void) {
+  u32_tickCount++;
+#if USE_HEARTBEAT && USE_HEARTBEAT_TICK
+  u16_heartbeatMs += ESOS_TICK_MS;
+  if (u16_heartbeatMs >= HEARTBEAT_TICK_MS) {
+    u16_heartbeatMs = 0;
+    HB_LED = !HB_LED;
+  }
+#endif
+  _T1IF = 0;
+}
+
+/** Starts Timer1 with a period of ESOS_TICK_MS. */
+void __esos_hw_InitSystemTick(void) {
+  T1CON = T1_OFF | T1_IDLE_CON | T1_GATE_OFF
+          | T1_SYNC_EXT_OFF | T1_SOURCE_INT
+          | T1_PS_1_8;
+  PR1 = msToU16Ticks(ESOS_TICK_MS, getTimerPrescale(T1CONbits)) - 1;
+  TMR1 = 0;
+  u32_tickCount = 0;
+  _T1IF = 0;
+  _T1IP = ESOS_TICK_INTERRUPT_PRIORITY;
+  _T1IE = 1;
+  T1CONbits.TON = 1;
+}
+
+/** Sets the Timer1 period for ESOS_TICK_MS again, for a new
+ *  \ref FCY_NOW (see setClockProfile()). The 1:8 prescale keeps the
+ *  period within 0.1% at the FRC's 3.685 MHz as well as at full speed.
+ */
+void __esos_hw_RetuneSystemTick(void) {
+  PR1 = msToU16Ticks(ESOS_TICK_MS, getTimerPrescale(T1CONbits)) - 1;
+  // a shorter period could leave TMR1 past it, to run on to 0xFFFF
+  if (TMR1 > PR1) TMR1 = 0;
+}
+
+/** \return Ticks since __esos_hw_InitSystemTick(). The Timer1 interrupt
+ *  is held off for the read, since a 32-bit read takes two instructions.
+ */
+uint32_t __esos_hw_GetSystemTickCount(void) {
+  uint32_t u32_ticks;
+
+  _T1IE = 0;
+  u32_ticks = u32_tickCount;
+  _T1IE = 1;
+  return u32_ticks;
+}
+
+/** Called after every scheduler pass: Idle mode until an interrupt
+ *  (the tick, a change notification, a peripheral) wakes the core.
+ *  Peripherals left running in Idle keep going meanwhile.
+ */
+void __esos_hw_Idle(void) {
+  IDLE();
+}
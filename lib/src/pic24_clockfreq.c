@@ -261,6 +261,41 @@ void switchClock(uint8_t u8_source) {
 #endif
 }
 
+#if USE_CLOCK_PROFILES
+/** The processor clock frequency right now; see \ref FCY_NOW. */
+uint32_t u32_fcy = FCY;
+static uint8_t u8_clockProfile = CLOCK_PROFILE_FULL;
+
+/** Switch between \ref CLOCK_CONFIG and the bare FRC at run time.
+ *  The configClock() function must have run first: going back to
+ *  CLOCK_PROFILE_FULL reuses the PLL settings it made, and waits for
+ *  the PLL to lock again.
+ *
+ *  Only \ref FCY_NOW, and so the delays, follow the switch. Anything
+ *  clocked from FCY (UART and I2C baud rates, SPI prescalers, timer
+ *  periods) runs at the wrong speed until the caller sets it up again,
+ *  and a byte going out across the switch is garbled, so switch with
+ *  the peripherals idle.
+ *  \param u8_profile CLOCK_PROFILE_FULL or CLOCK_PROFILE_LOW
+ */
+void setClockProfile(uint8_t u8_profile) {
+  if (u8_profile == u8_clockProfile) return;
+  if (u8_profile == CLOCK_PROFILE_LOW) {
+    switchClock(GET_OSC_SEL_BITS(FNOSC_FRC));
+    u32_fcy = CLOCK_LOW_FCY;
+  } else {
+    switchClock(OSC_SEL_BITS);
+    u32_fcy = FCY;
+  }
+  u8_clockProfile = u8_profile;
+}
+
+/** \return The profile last given to setClockProfile(). */
+uint8_t getClockProfile(void) {
+  return u8_clockProfile;
+}
+#endif
+
 #if IS_CLOCK_CONFIG(SIM_CLOCK)
 # warning "Clock configured for simulation, FCY = 1 Mhz."
 #endif
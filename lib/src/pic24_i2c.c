@@ -31,6 +31,8 @@
 #include <stdio.h>   //for NULL definition
 #include "pic24_util.h"
 #include "pic24_clockfreq.h"
+#include "pic24_delay.h"
+#include "pic24_time.h"
 
 // Only include if this UART exists.
 #if (NUM_I2C_MODS >= 1)
@@ -41,9 +43,27 @@
 // will only see it once.
 /** \file
  *  I2C support functions. \see pic24_i2c.h for details.
+ *  \par Queued transactions
+ *  queueI2Cx() takes a transaction (\ref I2C_XFER): a list of steps (start or
+ *  repeated start, write bytes, read bytes, stop) and a callback for when it is over.
+ *  By default it runs it at once with the blocking operations. Define the macro
+ *  I2Cx_INTERRUPT (i.e., I2C1_INTERRUPT) in your project file if you want it queued
+ *  instead, for the MI2Cx interrupt to run a step at a time while the program
+ *  goes on; the callback is then called from the interrupt.
+ *  For interrupt-driven transactions, macro I2Cx_QUEUE_SIZE sets how many can be queued
+ *  (default 4, one fewer fit), and I2Cx_INTERRUPT_PRIORITY sets the priority (default 1).
+ *  Don't use the blocking operations on the module while it has transactions queued.
+ *  \par Timeouts
+ *  The primitive operations arm the watchdog, so a bus that stops answering resets
+ *  the chip (and a NAK to putI2Cx() ends in reportError()). The tryXxxI2Cx() ones
+ *  (tryStartI2Cx(), tryPutI2Cx(), ...) give up after \ref I2C_TIMEOUT_US instead,
+ *  timed with micros() (so configTime32() must have been called), and return
+ *  \ref I2C_TIMEOUT; recoverI2Cx() then frees the bus.
  */
 
 
+static uint16_t u16_FkHZI2C1 = 100;  //last speed set, for recoverI2C1()
+
 /**
 Configure and enable the I2C1 module for operation at \em u16_FkHZ kHZ clock speed.
 \param u16_FkHZ specifies clock speed in kHZ
@@ -51,12 +71,13 @@ Configure and enable the I2C1 module for operation at \em u16_FkHZ kHZ clock spe
 void configI2C1(uint16_t u16_FkHZ) {
   uint16_t u16_temp;
 
-  u16_temp = (FCY/1000L)/((uint16_t) u16_FkHZ);
+  u16_FkHZI2C1 = u16_FkHZ;
+  u16_temp = (FCY_NOW/1000L)/((uint16_t) u16_FkHZ);
 #if defined(__PIC24E__) || defined(__dsPIC33E__)
   // This ignores the gobbler pulse delay, which is device dependent and small.
   u16_temp = (u16_temp  - 1);
 #else
-  u16_temp = u16_temp - FCY/10000000L - 1;
+  u16_temp = u16_temp - FCY_NOW/10000000L - 1;
 #endif
   // The SCL divider only uses 9 bits.
   if (u16_temp > 511)  u16_temp = 511;
@@ -177,6 +198,133 @@ uint8_t getI2C1(uint8_t u8_ack2Send) {
   sz_lastTimeoutError = NULL;
   return(u8_inByte);                  //return the value
 }
+/**
+Wait for the start, repeated start, stop, receive or ACK under way to finish.
+\param u32_deadline micros() time to give up at
+\return \ref I2C_ACK once it has, or \ref I2C_TIMEOUT
+*/
+static uint8_t waitIdleI2C1(uint32_t u32_deadline) {
+  while (I2C1CON & 0x1F) {  //lower 5 bits clear when done
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  return I2C_ACK;
+}
+
+/**
+Check for, and clear, a bus collision (BCL: SDA held low through a start, restart
+or byte out, which the hardware then ends at once) or a write to I2C1TRN it ignored
+(IWCOL).
+\return \ref I2C_TIMEOUT if there was one (the bus is stuck, see recoverI2C1()),
+otherwise \em u8_ack
+*/
+static uint8_t collisionI2C1(uint8_t u8_ack) {
+  if (!I2C1STATbits.BCL && !I2C1STATbits.IWCOL) return u8_ack;
+  I2C1STATbits.BCL = 0;
+  I2C1STATbits.IWCOL = 0;
+  return I2C_TIMEOUT;
+}
+
+/**
+Operation: Perform an I2C start operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C1())
+*/
+uint8_t tryStartI2C1(void) {
+  I2C1CONbits.SEN = 1; // initiate start
+  return collisionI2C1(waitIdleI2C1(deadlineUs(I2C_TIMEOUT_US)));
+}
+
+/**
+Operation: Perform an I2C repeated start operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C1())
+*/
+uint8_t tryRstartI2C1(void) {
+  I2C1CONbits.RSEN = 1; // initiate repeated start
+  return collisionI2C1(waitIdleI2C1(deadlineUs(I2C_TIMEOUT_US)));
+}
+
+/**
+Operation: Perform an I2C stop operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C1())
+*/
+uint8_t tryStopI2C1(void) {
+  I2C1CONbits.PEN = 1; // initiate stop
+  return waitIdleI2C1(deadlineUs(I2C_TIMEOUT_US));
+}
+
+/**
+Operation: Send one byte (\em u8_val), giving up after \ref I2C_TIMEOUT_US.
+A NAK is returned, not reported.
+\param u8_val byte to send
+\return Ack bit value returned from slave, or \ref I2C_TIMEOUT if the bus is stuck
+*/
+uint8_t tryPutI2C1(uint8_t u8_val) {
+  uint32_t u32_deadline = deadlineUs(I2C_TIMEOUT_US);
+
+  I2C1TRN = u8_val;  // write byte
+  while (I2C1STATbits.TRSTAT) { // wait for 8bits+ ack bit to finish
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  //ACKSTAT is stale if the byte didn't go out
+  return collisionI2C1(I2C1STATbits.ACKSTAT);
+}
+
+/**
+Operation: Read a byte, sending \em u8_ack2Send back, giving up after \ref I2C_TIMEOUT_US.
+\param u8_ack2Send ack bit to send back to slave after byte is read
+\param pu8_byte gets the byte read from slave
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck
+*/
+uint8_t tryGetI2C1(uint8_t u8_ack2Send, uint8_t* pu8_byte) {
+  uint32_t u32_deadline = deadlineUs(I2C_TIMEOUT_US);
+
+  if (waitIdleI2C1(u32_deadline) != I2C_ACK) return I2C_TIMEOUT;
+  I2C1CONbits.RCEN = 1;           //enable receive
+  while (!I2C1STATbits.RBF) {     //wait for receive byte
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  *pu8_byte = I2C1RCV;            //read byte
+  I2C1CONbits.ACKDT = u8_ack2Send; //ACK bit to send back on receive
+  I2C1CONbits.ACKEN = 1;          //enable ACKbit transmittion
+  return waitIdleI2C1(u32_deadline);
+}
+
+/**
+Operation: Free a stuck bus and start the I2C1 module afresh, at the speed last given
+to configI2C1() (BRG worked out again for the clock now). A slave left half way
+through a byte, by a reset of the master say, can hold SDA low for good; nine clocks
+let it finish the byte, and a stop puts it back to idle. The clocks are toggled by
+hand if the project names the pins' port bits (macros I2C1_SCL_TRIS, I2C1_SCL_LAT,
+I2C1_SDA_TRIS, I2C1_SDA_LAT, i.e. _TRISB8); otherwise only the module is reset.
+*/
+void recoverI2C1(void) {
+#if defined(I2C1_SCL_TRIS) && defined(I2C1_SCL_LAT) && defined(I2C1_SDA_TRIS) && defined(I2C1_SDA_LAT)
+  uint8_t u8_i;
+
+  I2C1CONbits.I2CEN = 0;  //the port has the pins
+  //open drain by hand: an output low, or an input for the pull-up to take high
+  I2C1_SCL_LAT = 0;
+  I2C1_SDA_LAT = 0;
+  I2C1_SDA_TRIS = 1;
+  for (u8_i = 0; u8_i < 9; u8_i++) {
+    I2C1_SCL_TRIS = 0;
+    DELAY_US(5);
+    I2C1_SCL_TRIS = 1;
+    DELAY_US(5);
+  }
+  //stop: SDA rises while SCL is high
+  I2C1_SCL_TRIS = 0;
+  I2C1_SDA_TRIS = 0;
+  DELAY_US(5);
+  I2C1_SCL_TRIS = 1;
+  DELAY_US(5);
+  I2C1_SDA_TRIS = 1;
+  DELAY_US(5);
+#endif
+  I2C1CON = 0;  //module off, nothing under way
+  I2C1STATbits.BCL = 0;
+  configI2C1(u16_FkHZI2C1);
+}
+
 /**
 Transaction: Write 1 byte (\em u8_d1) to I2C slave at address \em u8_addr.
 \param u8_addr  Slave I2C address
@@ -263,6 +411,243 @@ void readNI2C1(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt) {
   stopI2C1();
 }
 
+#ifdef I2C1_INTERRUPT
+
+# ifndef I2C1_QUEUE_SIZE
+#   define I2C1_QUEUE_SIZE 4  //transactions waiting, the one running included
+# endif
+
+# ifndef I2C1_INTERRUPT_PRIORITY
+#   define I2C1_INTERRUPT_PRIORITY 1
+# endif
+
+//where the running transaction is: its step, the byte in that step, and
+//what the next MI2C1 interrupt means
+#define I2C_PHASE_ISSUE 0   //nothing started for this step yet
+#define I2C_PHASE_WAIT  1   //start, stop, byte out or byte in finishing
+#define I2C_PHASE_ACK   2   //ACK/NAK after a byte in finishing
+#define I2C_PHASE_FAIL  3   //stop after a NAK finishing
+#define I2C_PHASE_BUS   4   //bus collision: over, without a stop
+
+static I2C_XFER* volatile apst_queueI2C1[I2C1_QUEUE_SIZE];
+static volatile uint8_t u8_queueI2C1Head = 0;
+static volatile uint8_t u8_queueI2C1Tail = 0;
+static uint8_t u8_stepI2C1;
+static uint16_t u16_byteI2C1;
+static uint8_t u8_phaseI2C1;
+
+/**
+ * Queues a transaction for the MI2C1 interrupt to run, after those
+ * already queued. The transaction, its steps and their buffers must stay
+ * put until its status is no longer \ref I2C_XFER_PENDING.
+ * \param pst_xfer Transaction; its status is set to \ref I2C_XFER_PENDING
+ * \return 1 if queued, 0 if the queue is full
+ */
+uint8_t queueI2C1(I2C_XFER* pst_xfer) {
+  uint8_t u8_next;
+
+  u8_next = u8_queueI2C1Head + 1;
+  if (u8_next == I2C1_QUEUE_SIZE) u8_next = 0; //wrap if needed
+  if (u8_next == u8_queueI2C1Tail) return 0;
+
+  pst_xfer->u8_status = I2C_XFER_PENDING;
+  apst_queueI2C1[u8_queueI2C1Head] = pst_xfer;
+  u8_queueI2C1Head = u8_next;
+  if (!_MI2C1IE) {
+    //idle: start it by flagging a step as just finished
+    u8_stepI2C1 = 0;
+    u16_byteI2C1 = 0;
+    u8_phaseI2C1 = I2C_PHASE_ISSUE;
+    _MI2C1IP = I2C1_INTERRUPT_PRIORITY;
+    _MI2C1IF = 1;
+    _MI2C1IE = 1;
+  }
+  return 1;
+}
+
+/**
+ * \return 1 once every queued transaction has finished
+ */
+uint8_t isIdleQueueI2C1(void) {
+  return !_MI2C1IE;
+}
+
+/**
+ * Gives up on the queued transactions, the one running included, when the bus
+ * has stopped answering: each gets \ref I2C_XFER_TIMEOUT and its callback
+ * (called from here), then recoverI2C1() frees the bus.
+ */
+void abortQueueI2C1(void) {
+  I2C_XFER* pst_xfer;
+
+  _MI2C1IE = 0;
+  while (u8_queueI2C1Head != u8_queueI2C1Tail) {
+    pst_xfer = apst_queueI2C1[u8_queueI2C1Tail];
+    u8_queueI2C1Tail = (u8_queueI2C1Tail + 1 == I2C1_QUEUE_SIZE) ? 0 : u8_queueI2C1Tail + 1;
+    pst_xfer->u8_status = I2C_XFER_TIMEOUT;
+    if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+  }
+  recoverI2C1();
+}
+
+/**
+ * Runs the queued transactions: each interrupt is the end of a start,
+ * stop, byte out, byte in or ACK, and issues the next of those.
+ */
+void _ISR _MI2C1Interrupt(void) {
+  I2C_XFER* pst_xfer;
+  const I2C_STEP* pst_step;
+
+  _MI2C1IF = 0;
+  if (I2C1STATbits.BCL) {
+    //another master, or a slave holding SDA low: see recoverI2C1()
+    I2C1STATbits.BCL = 0;
+    u8_phaseI2C1 = I2C_PHASE_BUS;
+  }
+  while (u8_queueI2C1Head != u8_queueI2C1Tail) {
+    pst_xfer = apst_queueI2C1[u8_queueI2C1Tail];
+
+    if (u8_phaseI2C1 >= I2C_PHASE_FAIL || u8_stepI2C1 == pst_xfer->u8_steps) {
+      //transaction over: report it, then on to the next
+      if (u8_phaseI2C1 == I2C_PHASE_BUS) pst_xfer->u8_status = I2C_XFER_TIMEOUT;
+      else if (u8_phaseI2C1 == I2C_PHASE_FAIL) pst_xfer->u8_status = I2C_XFER_NAK;
+      else pst_xfer->u8_status = I2C_XFER_OK;
+      u8_queueI2C1Tail = (u8_queueI2C1Tail + 1 == I2C1_QUEUE_SIZE) ? 0 : u8_queueI2C1Tail + 1;
+      u8_stepI2C1 = 0;
+      u16_byteI2C1 = 0;
+      u8_phaseI2C1 = I2C_PHASE_ISSUE;
+      if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+      continue;
+    }
+
+    pst_step = &pst_xfer->pst_steps[u8_stepI2C1];
+    switch (pst_step->u8_op) {
+      case I2C_OP_START:
+        if (u8_phaseI2C1 == I2C_PHASE_ISSUE) {
+          u8_phaseI2C1 = I2C_PHASE_WAIT;
+          if (u8_stepI2C1 == 0) I2C1CONbits.SEN = 1;
+          else I2C1CONbits.RSEN = 1;
+          return;
+        }
+        break;
+      case I2C_OP_WRITE:
+        if (u8_phaseI2C1 == I2C_PHASE_WAIT) {
+          //a byte went out: a NAK ends the transaction with a stop
+          if (I2C1STATbits.ACKSTAT != I2C_ACK) {
+            u8_phaseI2C1 = I2C_PHASE_FAIL;
+            I2C1CONbits.PEN = 1;
+            return;
+          }
+          u16_byteI2C1++;
+        }
+        if (u16_byteI2C1 < pst_step->u16_len) {
+          u8_phaseI2C1 = I2C_PHASE_WAIT;
+          I2C1TRN = pst_step->pu8_data[u16_byteI2C1];
+          return;
+        }
+        break;
+      case I2C_OP_READ:
+        if (u8_phaseI2C1 == I2C_PHASE_WAIT) {
+          //a byte came in: ACK it, or NAK the last
+          pst_step->pu8_data[u16_byteI2C1] = I2C1RCV;
+          u8_phaseI2C1 = I2C_PHASE_ACK;
+          I2C1CONbits.ACKDT = (u16_byteI2C1 + 1 == pst_step->u16_len) ? I2C_NAK : I2C_ACK;
+          I2C1CONbits.ACKEN = 1;
+          return;
+        }
+        if (u8_phaseI2C1 == I2C_PHASE_ACK) u16_byteI2C1++;
+        if (u16_byteI2C1 < pst_step->u16_len) {
+          u8_phaseI2C1 = I2C_PHASE_WAIT;
+          I2C1CONbits.RCEN = 1;
+          return;
+        }
+        break;
+      default: //I2C_OP_STOP
+        if (u8_phaseI2C1 == I2C_PHASE_ISSUE) {
+          u8_phaseI2C1 = I2C_PHASE_WAIT;
+          I2C1CONbits.PEN = 1;
+          return;
+        }
+        break;
+    }
+
+    //step over, on to the next
+    u8_stepI2C1++;
+    u16_byteI2C1 = 0;
+    u8_phaseI2C1 = I2C_PHASE_ISSUE;
+  }
+  //nothing left: disable the interrupt
+  _MI2C1IE = 0;
+}
+
+#undef I2C_PHASE_ISSUE
+#undef I2C_PHASE_WAIT
+#undef I2C_PHASE_ACK
+#undef I2C_PHASE_FAIL
+#undef I2C_PHASE_BUS
+
+#else
+
+/**
+ * Runs a transaction at once with the tryXxxI2C1() operations, then calls
+ * its callback. Define I2C1_INTERRUPT to queue it for the MI2C1
+ * interrupt instead.
+ * \param pst_xfer Transaction
+ * \return 1, always
+ */
+uint8_t queueI2C1(I2C_XFER* pst_xfer) {
+  const I2C_STEP* pst_step;
+  uint8_t u8_step;
+  uint16_t u16_i;
+  uint8_t u8_ack = I2C_ACK;
+
+  for (u8_step = 0; u8_step < pst_xfer->u8_steps && u8_ack == I2C_ACK; u8_step++) {
+    pst_step = &pst_xfer->pst_steps[u8_step];
+    switch (pst_step->u8_op) {
+      case I2C_OP_START:
+        u8_ack = (u8_step == 0) ? tryStartI2C1() : tryRstartI2C1();
+        break;
+      case I2C_OP_WRITE:
+        for (u16_i = 0; u16_i < pst_step->u16_len && u8_ack == I2C_ACK; u16_i++) {
+          u8_ack = tryPutI2C1(pst_step->pu8_data[u16_i]);
+        }
+        break;
+      case I2C_OP_READ:
+        for (u16_i = 0; u16_i < pst_step->u16_len && u8_ack == I2C_ACK; u16_i++) {
+          u8_ack = tryGetI2C1(u16_i + 1 == pst_step->u16_len ? I2C_NAK : I2C_ACK, &pst_step->pu8_data[u16_i]);
+        }
+        break;
+      default: //I2C_OP_STOP
+        u8_ack = tryStopI2C1();
+        break;
+    }
+  }
+  //a NAK ends the transaction with a stop; a stuck bus, with recoverI2C1()
+  if (u8_ack == I2C_NAK && tryStopI2C1() != I2C_ACK) u8_ack = I2C_TIMEOUT;
+  if (u8_ack == I2C_TIMEOUT) recoverI2C1();
+  pst_xfer->u8_status = (u8_ack == I2C_ACK) ? I2C_XFER_OK :
+                        (u8_ack == I2C_NAK) ? I2C_XFER_NAK : I2C_XFER_TIMEOUT;
+  if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+  return 1;
+}
+
+/**
+ * \return 1, always; nothing is queued without I2C1_INTERRUPT
+ */
+uint8_t isIdleQueueI2C1(void) {
+  return 1;
+}
+
+/**
+ * Nothing is queued without I2C1_INTERRUPT: just frees the bus, as
+ * recoverI2C1().
+ */
+void abortQueueI2C1(void) {
+  recoverI2C1();
+}
+
+#endif // #ifdef I2C1_INTERRUPT
+
 #endif // #if (NUM_I2C_MODS >= 1)
 
 
@@ -309,6 +694,8 @@ void readNI2C1(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt) {
 #include <stdio.h>   //for NULL definition
 #include "pic24_util.h"
 #include "pic24_clockfreq.h"
+#include "pic24_delay.h"
+#include "pic24_time.h"
 
 // Only include if this UART exists.
 #if (NUM_I2C_MODS >= 2)
@@ -319,9 +706,27 @@ void readNI2C1(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt) {
 // will only see it once.
 /** \file
  *  I2C support functions. \see pic24_i2c.h for details.
+ *  \par Queued transactions
+ *  queueI2Cx() takes a transaction (\ref I2C_XFER): a list of steps (start or
+ *  repeated start, write bytes, read bytes, stop) and a callback for when it is over.
+ *  By default it runs it at once with the blocking operations. Define the macro
+ *  I2Cx_INTERRUPT (i.e., I2C1_INTERRUPT) in your project file if you want it queued
+ *  instead, for the MI2Cx interrupt to run a step at a time while the program
+ *  goes on; the callback is then called from the interrupt.
+ *  For interrupt-driven transactions, macro I2Cx_QUEUE_SIZE sets how many can be queued
+ *  (default 4, one fewer fit), and I2Cx_INTERRUPT_PRIORITY sets the priority (default 1).
+ *  Don't use the blocking operations on the module while it has transactions queued.
+ *  \par Timeouts
+ *  The primitive operations arm the watchdog, so a bus that stops answering resets
+ *  the chip (and a NAK to putI2Cx() ends in reportError()). The tryXxxI2Cx() ones
+ *  (tryStartI2Cx(), tryPutI2Cx(), ...) give up after \ref I2C_TIMEOUT_US instead,
+ *  timed with micros() (so configTime32() must have been called), and return
+ *  \ref I2C_TIMEOUT; recoverI2Cx() then frees the bus.
  */
 
 
+static uint16_t u16_FkHZI2C2 = 100;  //last speed set, for recoverI2C2()
+
 /**
 Configure and enable the I2C2 module for operation at \em u16_FkHZ kHZ clock speed.
 \param u16_FkHZ specifies clock speed in kHZ
@@ -329,12 +734,13 @@ Configure and enable the I2C2 module for operation at \em u16_FkHZ kHZ clock spe
 void configI2C2(uint16_t u16_FkHZ) {
   uint16_t u16_temp;
 
-  u16_temp = (FCY/1000L)/((uint16_t) u16_FkHZ);
+  u16_FkHZI2C2 = u16_FkHZ;
+  u16_temp = (FCY_NOW/1000L)/((uint16_t) u16_FkHZ);
 #if defined(__PIC24E__) || defined(__dsPIC33E__)
   // This ignores the gobbler pulse delay, which is device dependent and small.
   u16_temp = (u16_temp  - 1);
 #else
-  u16_temp = u16_temp - FCY/10000000L - 1;
+  u16_temp = u16_temp - FCY_NOW/10000000L - 1;
 #endif
   // The SCL divider only uses 9 bits.
   if (u16_temp > 511)  u16_temp = 511;
@@ -455,6 +861,133 @@ uint8_t getI2C2(uint8_t u8_ack2Send) {
   sz_lastTimeoutError = NULL;
   return(u8_inByte);                  //return the value
 }
+/**
+Wait for the start, repeated start, stop, receive or ACK under way to finish.
+\param u32_deadline micros() time to give up at
+\return \ref I2C_ACK once it has, or \ref I2C_TIMEOUT
+*/
+static uint8_t waitIdleI2C2(uint32_t u32_deadline) {
+  while (I2C2CON & 0x1F) {  //lower 5 bits clear when done
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  return I2C_ACK;
+}
+
+/**
+Check for, and clear, a bus collision (BCL: SDA held low through a start, restart
+or byte out, which the hardware then ends at once) or a write to I2C2TRN it ignored
+(IWCOL).
+\return \ref I2C_TIMEOUT if there was one (the bus is stuck, see recoverI2C2()),
+otherwise \em u8_ack
+*/
+static uint8_t collisionI2C2(uint8_t u8_ack) {
+  if (!I2C2STATbits.BCL && !I2C2STATbits.IWCOL) return u8_ack;
+  I2C2STATbits.BCL = 0;
+  I2C2STATbits.IWCOL = 0;
+  return I2C_TIMEOUT;
+}
+
+/**
+Operation: Perform an I2C start operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C2())
+*/
+uint8_t tryStartI2C2(void) {
+  I2C2CONbits.SEN = 1; // initiate start
+  return collisionI2C2(waitIdleI2C2(deadlineUs(I2C_TIMEOUT_US)));
+}
+
+/**
+Operation: Perform an I2C repeated start operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C2())
+*/
+uint8_t tryRstartI2C2(void) {
+  I2C2CONbits.RSEN = 1; // initiate repeated start
+  return collisionI2C2(waitIdleI2C2(deadlineUs(I2C_TIMEOUT_US)));
+}
+
+/**
+Operation: Perform an I2C stop operation, giving up after \ref I2C_TIMEOUT_US.
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck (see recoverI2C2())
+*/
+uint8_t tryStopI2C2(void) {
+  I2C2CONbits.PEN = 1; // initiate stop
+  return waitIdleI2C2(deadlineUs(I2C_TIMEOUT_US));
+}
+
+/**
+Operation: Send one byte (\em u8_val), giving up after \ref I2C_TIMEOUT_US.
+A NAK is returned, not reported.
+\param u8_val byte to send
+\return Ack bit value returned from slave, or \ref I2C_TIMEOUT if the bus is stuck
+*/
+uint8_t tryPutI2C2(uint8_t u8_val) {
+  uint32_t u32_deadline = deadlineUs(I2C_TIMEOUT_US);
+
+  I2C2TRN = u8_val;  // write byte
+  while (I2C2STATbits.TRSTAT) { // wait for 8bits+ ack bit to finish
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  //ACKSTAT is stale if the byte didn't go out
+  return collisionI2C2(I2C2STATbits.ACKSTAT);
+}
+
+/**
+Operation: Read a byte, sending \em u8_ack2Send back, giving up after \ref I2C_TIMEOUT_US.
+\param u8_ack2Send ack bit to send back to slave after byte is read
+\param pu8_byte gets the byte read from slave
+\return \ref I2C_ACK, or \ref I2C_TIMEOUT if the bus is stuck
+*/
+uint8_t tryGetI2C2(uint8_t u8_ack2Send, uint8_t* pu8_byte) {
+  uint32_t u32_deadline = deadlineUs(I2C_TIMEOUT_US);
+
+  if (waitIdleI2C2(u32_deadline) != I2C_ACK) return I2C_TIMEOUT;
+  I2C2CONbits.RCEN = 1;           //enable receive
+  while (!I2C2STATbits.RBF) {     //wait for receive byte
+    if (isDeadlinePassed(u32_deadline)) return I2C_TIMEOUT;
+  }
+  *pu8_byte = I2C2RCV;            //read byte
+  I2C2CONbits.ACKDT = u8_ack2Send; //ACK bit to send back on receive
+  I2C2CONbits.ACKEN = 1;          //enable ACKbit transmittion
+  return waitIdleI2C2(u32_deadline);
+}
+
+/**
+Operation: Free a stuck bus and start the I2C2 module afresh, at the speed last given
+to configI2C2() (BRG worked out again for the clock now). A slave left half way
+through a byte, by a reset of the master say, can hold SDA low for good; nine clocks
+let it finish the byte, and a stop puts it back to idle. The clocks are toggled by
+hand if the project names the pins' port bits (macros I2C2_SCL_TRIS, I2C2_SCL_LAT,
+I2C2_SDA_TRIS, I2C2_SDA_LAT, i.e. _TRISB8); otherwise only the module is reset.
+*/
+void recoverI2C2(void) {
+#if defined(I2C2_SCL_TRIS) && defined(I2C2_SCL_LAT) && defined(I2C2_SDA_TRIS) && defined(I2C2_SDA_LAT)
+  uint8_t u8_i;
+
+  I2C2CONbits.I2CEN = 0;  //the port has the pins
+  //open drain by hand: an output low, or an input for the pull-up to take high
+  I2C2_SCL_LAT = 0;
+  I2C2_SDA_LAT = 0;
+  I2C2_SDA_TRIS = 1;
+  for (u8_i = 0; u8_i < 9; u8_i++) {
+    I2C2_SCL_TRIS = 0;
+    DELAY_US(5);
+    I2C2_SCL_TRIS = 1;
+    DELAY_US(5);
+  }
+  //stop: SDA rises while SCL is high
+  I2C2_SCL_TRIS = 0;
+  I2C2_SDA_TRIS = 0;
+  DELAY_US(5);
+  I2C2_SCL_TRIS = 1;
+  DELAY_US(5);
+  I2C2_SDA_TRIS = 1;
+  DELAY_US(5);
+#endif
+  I2C2CON = 0;  //module off, nothing under way
+  I2C2STATbits.BCL = 0;
+  configI2C2(u16_FkHZI2C2);
+}
+
 /**
 Transaction: Write 1 byte (\em u8_d1) to I2C slave at address \em u8_addr.
 \param u8_addr  Slave I2C address
@@ -541,6 +1074,243 @@ void readNI2C2(uint8_t u8_addr,uint8_t* pu8_data, uint16_t u16_cnt) {
   stopI2C2();
 }
 
+#ifdef I2C2_INTERRUPT
+
+# ifndef I2C2_QUEUE_SIZE
+#   define I2C2_QUEUE_SIZE 4  //transactions waiting, the one running included
+# endif
+
+# ifndef I2C2_INTERRUPT_PRIORITY
+#   define I2C2_INTERRUPT_PRIORITY 1
+# endif
+
+//where the running transaction is: its step, the byte in that step, and
+//what the next MI2C2 interrupt means
+#define I2C_PHASE_ISSUE 0   //nothing started for this step yet
+#define I2C_PHASE_WAIT  1   //start, stop, byte out or byte in finishing
+#define I2C_PHASE_ACK   2   //ACK/NAK after a byte in finishing
+#define I2C_PHASE_FAIL  3   //stop after a NAK finishing
+#define I2C_PHASE_BUS   4   //bus collision: over, without a stop
+
+static I2C_XFER* volatile apst_queueI2C2[I2C2_QUEUE_SIZE];
+static volatile uint8_t u8_queueI2C2Head = 0;
+static volatile uint8_t u8_queueI2C2Tail = 0;
+static uint8_t u8_stepI2C2;
+static uint16_t u16_byteI2C2;
+static uint8_t u8_phaseI2C2;
+
+/**
+ * Queues a transaction for the MI2C2 interrupt to run, after those
+ * already queued. The transaction, its steps and their buffers must stay
+ * put until its status is no longer \ref I2C_XFER_PENDING.
+ * \param pst_xfer Transaction; its status is set to \ref I2C_XFER_PENDING
+ * \return 1 if queued, 0 if the queue is full
+ */
+uint8_t queueI2C2(I2C_XFER* pst_xfer) {
+  uint8_t u8_next;
+
+  u8_next = u8_queueI2C2Head + 1;
+  if (u8_next == I2C2_QUEUE_SIZE) u8_next = 0; //wrap if needed
+  if (u8_next == u8_queueI2C2Tail) return 0;
+
+  pst_xfer->u8_status = I2C_XFER_PENDING;
+  apst_queueI2C2[u8_queueI2C2Head] = pst_xfer;
+  u8_queueI2C2Head = u8_next;
+  if (!_MI2C2IE) {
+    //idle: start it by flagging a step as just finished
+    u8_stepI2C2 = 0;
+    u16_byteI2C2 = 0;
+    u8_phaseI2C2 = I2C_PHASE_ISSUE;
+    _MI2C2IP = I2C2_INTERRUPT_PRIORITY;
+    _MI2C2IF = 1;
+    _MI2C2IE = 1;
+  }
+  return 1;
+}
+
+/**
+ * \return 1 once every queued transaction has finished
+ */
+uint8_t isIdleQueueI2C2(void) {
+  return !_MI2C2IE;
+}
+
+/**
+ * Gives up on the queued transactions, the one running included, when the bus
+ * has stopped answering: each gets \ref I2C_XFER_TIMEOUT and its callback
+ * (called from here), then recoverI2C2() frees the bus.
+ */
+void abortQueueI2C2(void) {
+  I2C_XFER* pst_xfer;
+
+  _MI2C2IE = 0;
+  while (u8_queueI2C2Head != u8_queueI2C2Tail) {
+    pst_xfer = apst_queueI2C2[u8_queueI2C2Tail];
+    u8_queueI2C2Tail = (u8_queueI2C2Tail + 1 == I2C2_QUEUE_SIZE) ? 0 : u8_queueI2C2Tail + 1;
+    pst_xfer->u8_status = I2C_XFER_TIMEOUT;
+    if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+  }
+  recoverI2C2();
+}
+
+/**
+ * Runs the queued transactions: each interrupt is the end of a start,
+ * stop, byte out, byte in or ACK, and issues the next of those.
+ */
+void _ISR _MI2C2Interrupt(void) {
+  I2C_XFER* pst_xfer;
+  const I2C_STEP* pst_step;
+
+  _MI2C2IF = 0;
+  if (I2C2STATbits.BCL) {
+    //another master, or a slave holding SDA low: see recoverI2C2()
+    I2C2STATbits.BCL = 0;
+    u8_phaseI2C2 = I2C_PHASE_BUS;
+  }
+  while (u8_queueI2C2Head != u8_queueI2C2Tail) {
+    pst_xfer = apst_queueI2C2[u8_queueI2C2Tail];
+
+    if (u8_phaseI2C2 >= I2C_PHASE_FAIL || u8_stepI2C2 == pst_xfer->u8_steps) {
+      //transaction over: report it, then on to the next
+      if (u8_phaseI2C2 == I2C_PHASE_BUS) pst_xfer->u8_status = I2C_XFER_TIMEOUT;
+      else if (u8_phaseI2C2 == I2C_PHASE_FAIL) pst_xfer->u8_status = I2C_XFER_NAK;
+      else pst_xfer->u8_status = I2C_XFER_OK;
+      u8_queueI2C2Tail = (u8_queueI2C2Tail + 1 == I2C2_QUEUE_SIZE) ? 0 : u8_queueI2C2Tail + 1;
+      u8_stepI2C2 = 0;
+      u16_byteI2C2 = 0;
+      u8_phaseI2C2 = I2C_PHASE_ISSUE;
+      if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+      continue;
+    }
+
+    pst_step = &pst_xfer->pst_steps[u8_stepI2C2];
+    switch (pst_step->u8_op) {
+      case I2C_OP_START:
+        if (u8_phaseI2C2 == I2C_PHASE_ISSUE) {
+          u8_phaseI2C2 = I2C_PHASE_WAIT;
+          if (u8_stepI2C2 == 0) I2C2CONbits.SEN = 1;
+          else I2C2CONbits.RSEN = 1;
+          return;
+        }
+        break;
+      case I2C_OP_WRITE:
+        if (u8_phaseI2C2 == I2C_PHASE_WAIT) {
+          //a byte went out: a NAK ends the transaction with a stop
+          if (I2C2STATbits.ACKSTAT != I2C_ACK) {
+            u8_phaseI2C2 = I2C_PHASE_FAIL;
+            I2C2CONbits.PEN = 1;
+            return;
+          }
+          u16_byteI2C2++;
+        }
+        if (u16_byteI2C2 < pst_step->u16_len) {
+          u8_phaseI2C2 = I2C_PHASE_WAIT;
+          I2C2TRN = pst_step->pu8_data[u16_byteI2C2];
+          return;
+        }
+        break;
+      case I2C_OP_READ:
+        if (u8_phaseI2C2 == I2C_PHASE_WAIT) {
+          //a byte came in: ACK it, or NAK the last
+          pst_step->pu8_data[u16_byteI2C2] = I2C2RCV;
+          u8_phaseI2C2 = I2C_PHASE_ACK;
+          I2C2CONbits.ACKDT = (u16_byteI2C2 + 1 == pst_step->u16_len) ? I2C_NAK : I2C_ACK;
+          I2C2CONbits.ACKEN = 1;
+          return;
+        }
+        if (u8_phaseI2C2 == I2C_PHASE_ACK) u16_byteI2C2++;
+        if (u16_byteI2C2 < pst_step->u16_len) {
+          u8_phaseI2C2 = I2C_PHASE_WAIT;
+          I2C2CONbits.RCEN = 1;
+          return;
+        }
+        break;
+      default: //I2C_OP_STOP
+        if (u8_phaseI2C2 == I2C_PHASE_ISSUE) {
+          u8_phaseI2C2 = I2C_PHASE_WAIT;
+          I2C2CONbits.PEN = 1;
+          return;
+        }
+        break;
+    }
+
+    //step over, on to the next
+    u8_stepI2C2++;
+    u16_byteI2C2 = 0;
+    u8_phaseI2C2 = I2C_PHASE_ISSUE;
+  }
+  //nothing left: disable the interrupt
+  _MI2C2IE = 0;
+}
+
+#undef I2C_PHASE_ISSUE
+#undef I2C_PHASE_WAIT
+#undef I2C_PHASE_ACK
+#undef I2C_PHASE_FAIL
+#undef I2C_PHASE_BUS
+
+#else
+
+/**
+ * Runs a transaction at once with the tryXxxI2C2() operations, then calls
+ * its callback. Define I2C2_INTERRUPT to queue it for the MI2C2
+ * interrupt instead.
+ * \param pst_xfer Transaction
+ * \return 1, always
+ */
+uint8_t queueI2C2(I2C_XFER* pst_xfer) {
+  const I2C_STEP* pst_step;
+  uint8_t u8_step;
+  uint16_t u16_i;
+  uint8_t u8_ack = I2C_ACK;
+
+  for (u8_step = 0; u8_step < pst_xfer->u8_steps && u8_ack == I2C_ACK; u8_step++) {
+    pst_step = &pst_xfer->pst_steps[u8_step];
+    switch (pst_step->u8_op) {
+      case I2C_OP_START:
+        u8_ack = (u8_step == 0) ? tryStartI2C2() : tryRstartI2C2();
+        break;
+      case I2C_OP_WRITE:
+        for (u16_i = 0; u16_i < pst_step->u16_len && u8_ack == I2C_ACK; u16_i++) {
+          u8_ack = tryPutI2C2(pst_step->pu8_data[u16_i]);
+        }
+        break;
+      case I2C_OP_READ:
+        for (u16_i = 0; u16_i < pst_step->u16_len && u8_ack == I2C_ACK; u16_i++) {
+          u8_ack = tryGetI2C2(u16_i + 1 == pst_step->u16_len ? I2C_NAK : I2C_ACK, &pst_step->pu8_data[u16_i]);
+        }
+        break;
+      default: //I2C_OP_STOP
+        u8_ack = tryStopI2C2();
+        break;
+    }
+  }
+  //a NAK ends the transaction with a stop; a stuck bus, with recoverI2C2()
+  if (u8_ack == I2C_NAK && tryStopI2C2() != I2C_ACK) u8_ack = I2C_TIMEOUT;
+  if (u8_ack == I2C_TIMEOUT) recoverI2C2();
+  pst_xfer->u8_status = (u8_ack == I2C_ACK) ? I2C_XFER_OK :
+                        (u8_ack == I2C_NAK) ? I2C_XFER_NAK : I2C_XFER_TIMEOUT;
+  if (pst_xfer->pfn_done) pst_xfer->pfn_done(pst_xfer);
+  return 1;
+}
+
+/**
+ * \return 1, always; nothing is queued without I2C2_INTERRUPT
+ */
+uint8_t isIdleQueueI2C2(void) {
+  return 1;
+}
+
+/**
+ * Nothing is queued without I2C2_INTERRUPT: just frees the bus, as
+ * recoverI2C2().
+ */
+void abortQueueI2C2(void) {
+  recoverI2C2();
+}
+
+#endif // #ifdef I2C2_INTERRUPT
+
 #endif // #if (NUM_I2C_MODS >= 2)
 
 
@@ -41,8 +41,49 @@
  *  This file contains routines which configure and
  *  use the SPI module on the PIC24 uC.
  *  \see pic24_spi.h for more details.
+ *  \par Interrupt-driven TX
+ *  By default, writeQueueSPIx() writes one byte and waits for it, like ioMasterSPIx().
+ *  Define the macro SPIx_TX_INTERRUPT (i.e., SPI1_TX_INTERRUPT) in your project file if you want it to queue bytes instead, for the SPIx interrupt to send.
+ *  For interrupt-driven TX, macro SPIx_TX_FIFO_SIZE sets the TX software FIFO size (default 32), and SPIx_TX_INTERRUPT_PRIORITY sets the priority (default 1).
+ *  Queued bytes are tagged \ref SPI_TX_CMD or \ref SPI_TX_DATA; if the macro SPIx_TX_DC_PIN names a latch bit (i.e., _LATB12), that pin follows the tag
+ *  (low for commands, high for data), as for the D/C line of an LCD controller. RX data is discarded.
+ *  In enhanced buffer mode (SPIBEN) each interrupt fills the 8-deep hardware FIFO, up to a change of tag;
+ *  set SISEL to \ref SPI_SISEL_TX_COMPLETE so the next interrupt comes once it has all shifted out.
+ * \par Block writes
+ *  writeBlockSPIx() writes a buffer as fast as the SPI clock allows, two bytes a frame in 16-bit mode.
+ * \par Prescalers
+ *  compute_spi_prescale() picks the prescaler bits for an SCK rate, so code that changes FCY at run time
+ *  (see setClockProfile()) can keep the SPI clock in range.
  */
 
+/** Pick the SPIxCON1 primary and secondary prescaler bits giving the
+ *  fastest SCK no faster than \em u32_sckHz. Both prescalers at 1:1 is
+ *  not allowed, so the fastest SCK is FCY/2.
+ *  \param u32_fcy Processor clock frequency (\ref FCY_NOW)
+ *  \param u32_sckHz Fastest SCK the device on the bus allows
+ *  \return PRI_PRESCAL_x_1 | SEC_PRESCAL_x_1 bits; the slowest
+ *          setting (64 x 8) if none is slow enough.
+ */
+uint16_t compute_spi_prescale(uint32_t u32_fcy, uint32_t u32_sckHz) {
+  static const uint16_t au16_priBits[] = { PRI_PRESCAL_1_1, PRI_PRESCAL_4_1,
+                                           PRI_PRESCAL_16_1, PRI_PRESCAL_64_1 };
+  uint16_t u16_best = PRI_PRESCAL_64_1 | SEC_PRESCAL_8_1;
+  uint16_t u16_bestDiv = 64 * 8;
+  uint16_t u16_pri, u16_sec, u16_div;
+  uint8_t u8_i;
+
+  for (u8_i = 0, u16_pri = 1; u8_i < 4; u8_i++, u16_pri *= 4) {
+    for (u16_sec = 1; u16_sec <= 8; u16_sec++) {
+      u16_div = u16_pri * u16_sec;
+      if (u16_div < 2 || u16_div >= u16_bestDiv) continue;
+      if (u32_fcy / u16_div > u32_sckHz) continue;
+      u16_bestDiv = u16_div;
+      u16_best = au16_priBits[u8_i] | ((8 - u16_sec) << 2);
+    }
+  }
+  return u16_best;
+}
+
 
 
 //SPI Receive Overflow freezes the SPI module
@@ -94,6 +135,172 @@ uint16_t ioMasterSPI1(uint16_t u16_c) {
   return(SPI1BUF);
 }
 
+/**
+ * Writes \em u16_len bytes from \em pu8_data to SPI1 and waits for
+ * the last one to shift out. Anything received is thrown away.
+ * In enhanced buffer mode (SPIBEN) the 8-deep TX FIFO is kept topped
+ * up, so the bus runs back to back at the SPI clock; otherwise it
+ * falls back to one ioMasterSPI1() per frame.
+ * In 16-bit mode (MODE16) each frame carries two bytes, high byte
+ * first, which is the same bit stream as 8-bit mode. An odd last
+ * byte is sent as the high byte of a frame padded with 0x00.
+ * \param pu8_data Bytes to write
+ * \param u16_len Number of bytes
+ */
+void writeBlockSPI1(const uint8_t *pu8_data, uint16_t u16_len) {
+  uint16_t u16_c;
+  uint8_t u8_step;
+
+  checkRxErrorSPI1();
+  u8_step = SPI1CON1bits.MODE16 ? 2 : 1;
+  while (u16_len) {
+    if (u8_step == 2) {
+      u16_c = (uint16_t) pu8_data[0] << 8;
+      if (u16_len > 1) u16_c |= pu8_data[1];
+      else u8_step = 1;  //padded last frame
+    } else {
+      u16_c = pu8_data[0];
+    }
+    pu8_data += u8_step;
+    u16_len -= u8_step;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+    if (SPI1CON2bits.SPIBEN) {
+      //wait for room, discarding RX so it can't overflow meanwhile
+      do {
+        while (!SPI1STATbits.SRXMPT) SPI1BUF;
+      } while (SPI1STATbits.SPITBF);
+      SPI1BUF = u16_c;
+      continue;
+    }
+#endif
+    ioMasterSPI1(u16_c);
+  }
+#if defined(_SRXMPT) && defined(_SPIBEN)
+  if (SPI1CON2bits.SPIBEN) {
+    //wait for the FIFO and shift register to empty
+    while (SPI1STATbits.SPIBEC || !SPI1STATbits.SRMPT) {
+      while (!SPI1STATbits.SRXMPT) SPI1BUF;
+    }
+    while (!SPI1STATbits.SRXMPT) SPI1BUF;
+  }
+#endif
+}
+
+#ifdef SPI1_TX_INTERRUPT
+
+# ifndef SPI1_TX_FIFO_SIZE
+#   define SPI1_TX_FIFO_SIZE 32  //choose a size
+# endif
+
+# ifndef SPI1_TX_INTERRUPT_PRIORITY
+#   define SPI1_TX_INTERRUPT_PRIORITY 1
+# endif
+
+//each entry is the byte, with its tag in bit 8
+volatile uint16_t au16_txFifoSPI1[SPI1_TX_FIFO_SIZE];
+volatile uint16_t u16_txFifoSPI1Head = 0;
+volatile uint16_t u16_txFifoSPI1Tail = 0;
+
+/**
+ * Queues \em u8_c for the SPI1 interrupt to send, waiting only if
+ * the queue is full. SPI1 must be configured for 8-bit master mode.
+ * With the enhanced buffer on (SPIBEN), the interrupt fills the
+ * 8-deep TX FIFO with queued bytes of the same tag, and SISEL must be
+ * \ref SPI_SISEL_TX_COMPLETE; with it off, it sends one at a time.
+ * \param u8_c Byte to write
+ * \param u8_tag \ref SPI_TX_CMD or \ref SPI_TX_DATA
+ */
+void writeQueueSPI1(uint8_t u8_c, uint8_t u8_tag) {
+  uint16_t u16_tmp;
+
+  u16_tmp = u16_txFifoSPI1Head;
+  u16_tmp++;
+  if (u16_tmp == SPI1_TX_FIFO_SIZE) u16_tmp = 0; //wrap if needed
+  while (u16_tmp == u16_txFifoSPI1Tail)
+    doHeartbeat();
+
+  au16_txFifoSPI1[u16_tmp] = u8_tag ? (0x0100 | u8_c) : u8_c; //write to buffer
+  u16_txFifoSPI1Head = u16_tmp;  //update head
+  if (!_SPI1IE) {
+    //idle: no transfer in flight, so flag one as just finished
+    _SPI1IP = SPI1_TX_INTERRUPT_PRIORITY;
+    _SPI1IF = 1;
+    _SPI1IE = 1;               //enable interrupt
+  }
+}
+
+/**
+ * \return 1 once every queued byte has been shifted out
+ */
+uint8_t isIdleQueueSPI1(void) {
+  return !_SPI1IE;
+}
+
+void _ISR _SPI1Interrupt (void) {
+  uint16_t u16_entry;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+  uint16_t u16_tmp;
+
+  while (SPI1CON2bits.SPIBEN && !SPI1STATbits.SRXMPT)
+    SPI1BUF;                 //discard all of RX
+#endif
+
+  SPI1BUF;                   //discard RX (legacy mode), so it never overflows
+  if (u16_txFifoSPI1Head == u16_txFifoSPI1Tail) {
+    //empty TX buffer, disable the interrupt, do not clear the flag
+    _SPI1IE = 0;
+  } else {
+    u16_txFifoSPI1Tail++;    //increment tail pointer
+    if (u16_txFifoSPI1Tail == SPI1_TX_FIFO_SIZE)
+      u16_txFifoSPI1Tail = 0; //wrap if needed
+    u16_entry = au16_txFifoSPI1[u16_txFifoSPI1Tail];
+#ifdef SPI1_TX_DC_PIN
+    //the last byte is out, so the tag line can change under this one
+    SPI1_TX_DC_PIN = (u16_entry >> 8);
+#endif
+    _SPI1IF = 0; //clear the interrupt flag
+    SPI1BUF = u16_entry & 0xFF;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+    //enhanced buffer mode: top up the hardware FIFO with bytes of the
+    //same tag; SISEL must be "transmit complete" for the next interrupt
+    while (SPI1CON2bits.SPIBEN && !SPI1STATbits.SPITBF &&
+           u16_txFifoSPI1Head != u16_txFifoSPI1Tail) {
+      u16_tmp = u16_txFifoSPI1Tail + 1;
+      if (u16_tmp == SPI1_TX_FIFO_SIZE) u16_tmp = 0;
+      if ((au16_txFifoSPI1[u16_tmp] ^ u16_entry) & 0x0100) break;
+      u16_txFifoSPI1Tail = u16_tmp;
+      SPI1BUF = au16_txFifoSPI1[u16_tmp] & 0xFF;
+    }
+#endif
+  }
+}
+
+#else
+
+/**
+ * Writes \em u8_c to SPI1 and waits for it. Define SPI1_TX_INTERRUPT
+ * to queue it instead.
+ * \param u8_c Byte to write
+ * \param u8_tag \ref SPI_TX_CMD or \ref SPI_TX_DATA
+ */
+void writeQueueSPI1(uint8_t u8_c, uint8_t u8_tag) {
+#ifdef SPI1_TX_DC_PIN
+  SPI1_TX_DC_PIN = u8_tag;
+#else
+  (void) u8_tag;
+#endif
+  ioMasterSPI1(u8_c);
+}
+
+/**
+ * \return 1, always; nothing is queued without SPI1_TX_INTERRUPT
+ */
+uint8_t isIdleQueueSPI1(void) {
+  return 1;
+}
+
+#endif // #ifdef SPI1_TX_INTERRUPT
+
 #endif // #if (NUM_SPI_MODS >= 1)
 
 
@@ -143,6 +350,19 @@ uint16_t ioMasterSPI1(uint16_t u16_c) {
  *  This file contains routines which configure and
  *  use the SPI module on the PIC24 uC.
  *  \see pic24_spi.h for more details.
+ *  \par Interrupt-driven TX
+ *  By default, writeQueueSPIx() writes one byte and waits for it, like ioMasterSPIx().
+ *  Define the macro SPIx_TX_INTERRUPT (i.e., SPI1_TX_INTERRUPT) in your project file if you want it to queue bytes instead, for the SPIx interrupt to send.
+ *  For interrupt-driven TX, macro SPIx_TX_FIFO_SIZE sets the TX software FIFO size (default 32), and SPIx_TX_INTERRUPT_PRIORITY sets the priority (default 1).
+ *  Queued bytes are tagged \ref SPI_TX_CMD or \ref SPI_TX_DATA; if the macro SPIx_TX_DC_PIN names a latch bit (i.e., _LATB12), that pin follows the tag
+ *  (low for commands, high for data), as for the D/C line of an LCD controller. RX data is discarded.
+ *  In enhanced buffer mode (SPIBEN) each interrupt fills the 8-deep hardware FIFO, up to a change of tag;
+ *  set SISEL to \ref SPI_SISEL_TX_COMPLETE so the next interrupt comes once it has all shifted out.
+ * \par Block writes
+ *  writeBlockSPIx() writes a buffer as fast as the SPI clock allows, two bytes a frame in 16-bit mode.
+ * \par Prescalers
+ *  compute_spi_prescale() picks the prescaler bits for an SCK rate, so code that changes FCY at run time
+ *  (see setClockProfile()) can keep the SPI clock in range.
  */
 
 
@@ -196,6 +416,172 @@ uint16_t ioMasterSPI2(uint16_t u16_c) {
   return(SPI2BUF);
 }
 
+/**
+ * Writes \em u16_len bytes from \em pu8_data to SPI2 and waits for
+ * the last one to shift out. Anything received is thrown away.
+ * In enhanced buffer mode (SPIBEN) the 8-deep TX FIFO is kept topped
+ * up, so the bus runs back to back at the SPI clock; otherwise it
+ * falls back to one ioMasterSPI2() per frame.
+ * In 16-bit mode (MODE16) each frame carries two bytes, high byte
+ * first, which is the same bit stream as 8-bit mode. An odd last
+ * byte is sent as the high byte of a frame padded with 0x00.
+ * \param pu8_data Bytes to write
+ * \param u16_len Number of bytes
+ */
+void writeBlockSPI2(const uint8_t *pu8_data, uint16_t u16_len) {
+  uint16_t u16_c;
+  uint8_t u8_step;
+
+  checkRxErrorSPI2();
+  u8_step = SPI2CON1bits.MODE16 ? 2 : 1;
+  while (u16_len) {
+    if (u8_step == 2) {
+      u16_c = (uint16_t) pu8_data[0] << 8;
+      if (u16_len > 1) u16_c |= pu8_data[1];
+      else u8_step = 1;  //padded last frame
+    } else {
+      u16_c = pu8_data[0];
+    }
+    pu8_data += u8_step;
+    u16_len -= u8_step;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+    if (SPI2CON2bits.SPIBEN) {
+      //wait for room, discarding RX so it can't overflow meanwhile
+      do {
+        while (!SPI2STATbits.SRXMPT) SPI2BUF;
+      } while (SPI2STATbits.SPITBF);
+      SPI2BUF = u16_c;
+      continue;
+    }
+#endif
+    ioMasterSPI2(u16_c);
+  }
+#if defined(_SRXMPT) && defined(_SPIBEN)
+  if (SPI2CON2bits.SPIBEN) {
+    //wait for the FIFO and shift register to empty
+    while (SPI2STATbits.SPIBEC || !SPI2STATbits.SRMPT) {
+      while (!SPI2STATbits.SRXMPT) SPI2BUF;
+    }
+    while (!SPI2STATbits.SRXMPT) SPI2BUF;
+  }
+#endif
+}
+
+#ifdef SPI2_TX_INTERRUPT
+
+# ifndef SPI2_TX_FIFO_SIZE
+#   define SPI2_TX_FIFO_SIZE 32  //choose a size
+# endif
+
+# ifndef SPI2_TX_INTERRUPT_PRIORITY
+#   define SPI2_TX_INTERRUPT_PRIORITY 1
+# endif
+
+//each entry is the byte, with its tag in bit 8
+volatile uint16_t au16_txFifoSPI2[SPI2_TX_FIFO_SIZE];
+volatile uint16_t u16_txFifoSPI2Head = 0;
+volatile uint16_t u16_txFifoSPI2Tail = 0;
+
+/**
+ * Queues \em u8_c for the SPI2 interrupt to send, waiting only if
+ * the queue is full. SPI2 must be configured for 8-bit master mode.
+ * With the enhanced buffer on (SPIBEN), the interrupt fills the
+ * 8-deep TX FIFO with queued bytes of the same tag, and SISEL must be
+ * \ref SPI_SISEL_TX_COMPLETE; with it off, it sends one at a time.
+ * \param u8_c Byte to write
+ * \param u8_tag \ref SPI_TX_CMD or \ref SPI_TX_DATA
+ */
+void writeQueueSPI2(uint8_t u8_c, uint8_t u8_tag) {
+  uint16_t u16_tmp;
+
+  u16_tmp = u16_txFifoSPI2Head;
+  u16_tmp++;
+  if (u16_tmp == SPI2_TX_FIFO_SIZE) u16_tmp = 0; //wrap if needed
+  while (u16_tmp == u16_txFifoSPI2Tail)
+    doHeartbeat();
+
+  au16_txFifoSPI2[u16_tmp] = u8_tag ? (0x0100 | u8_c) : u8_c; //write to buffer
+  u16_txFifoSPI2Head = u16_tmp;  //update head
+  if (!_SPI2IE) {
+    //idle: no transfer in flight, so flag one as just finished
+    _SPI2IP = SPI2_TX_INTERRUPT_PRIORITY;
+    _SPI2IF = 1;
+    _SPI2IE = 1;               //enable interrupt
+  }
+}
+
+/**
+ * \return 1 once every queued byte has been shifted out
+ */
+uint8_t isIdleQueueSPI2(void) {
+  return !_SPI2IE;
+}
+
+void _ISR _SPI2Interrupt (void) {
+  uint16_t u16_entry;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+  uint16_t u16_tmp;
+
+  while (SPI2CON2bits.SPIBEN && !SPI2STATbits.SRXMPT)
+    SPI2BUF;                 //discard all of RX
+#endif
+
+  SPI2BUF;                   //discard RX (legacy mode), so it never overflows
+  if (u16_txFifoSPI2Head == u16_txFifoSPI2Tail) {
+    //empty TX buffer, disable the interrupt, do not clear the flag
+    _SPI2IE = 0;
+  } else {
+    u16_txFifoSPI2Tail++;    //increment tail pointer
+    if (u16_txFifoSPI2Tail == SPI2_TX_FIFO_SIZE)
+      u16_txFifoSPI2Tail = 0; //wrap if needed
+    u16_entry = au16_txFifoSPI2[u16_txFifoSPI2Tail];
+#ifdef SPI2_TX_DC_PIN
+    //the last byte is out, so the tag line can change under this one
+    SPI2_TX_DC_PIN = (u16_entry >> 8);
+#endif
+    _SPI2IF = 0; //clear the interrupt flag
+    SPI2BUF = u16_entry & 0xFF;
+#if defined(_SRXMPT) && defined(_SPIBEN)
+    //enhanced buffer mode: top up the hardware FIFO with bytes of the
+    //same tag; SISEL must be "transmit complete" for the next interrupt
+    while (SPI2CON2bits.SPIBEN && !SPI2STATbits.SPITBF &&
+           u16_txFifoSPI2Head != u16_txFifoSPI2Tail) {
+      u16_tmp = u16_txFifoSPI2Tail + 1;
+      if (u16_tmp == SPI2_TX_FIFO_SIZE) u16_tmp = 0;
+      if ((au16_txFifoSPI2[u16_tmp] ^ u16_entry) & 0x0100) break;
+      u16_txFifoSPI2Tail = u16_tmp;
+      SPI2BUF = au16_txFifoSPI2[u16_tmp] & 0xFF;
+    }
+#endif
+  }
+}
+
+#else
+
+/**
+ * Writes \em u8_c to SPI2 and waits for it. Define SPI2_TX_INTERRUPT
+ * to queue it instead.
+ * \param u8_c Byte to write
+ * \param u8_tag \ref SPI_TX_CMD or \ref SPI_TX_DATA
+ */
+void writeQueueSPI2(uint8_t u8_c, uint8_t u8_tag) {
+#ifdef SPI2_TX_DC_PIN
+  SPI2_TX_DC_PIN = u8_tag;
+#else
+  (void) u8_tag;
+#endif
+  ioMasterSPI2(u8_c);
+}
+
+/**
+ * \return 1, always; nothing is queued without SPI2_TX_INTERRUPT
+ */
+uint8_t isIdleQueueSPI2(void) {
+  return 1;
+}
+
+#endif // #ifdef SPI2_TX_INTERRUPT
+
 #endif // #if (NUM_SPI_MODS >= 2)
 
 
@@ -0,0 +1,150 @@
+/*
+ * "Copyright (c) 2008 Robert B. Reese, Bryan A. Jones, J. W. Bruce ("AUTHORS")"
+ * All rights reserved.
+ * (R. Reese, reese_AT_ece.msstate.edu, Mississippi State University)
+ * (B. A. Jones, bjones_AT_ece.msstate.edu, Mississippi State University)
+ * (J. W. Bruce, jwbruce_AT_ece.msstate.edu, Mississippi State University)
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose, without fee, and without written agreement is
+ * hereby granted, provided that the above copyright notice, the following
+ * two paragraphs and the authors appear in all copies of this software.
+ *
+ * IN NO EVENT SHALL THE "AUTHORS" BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING OUT
+ * OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE "AUTHORS"
+ * HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE "AUTHORS" SPECIFICALLY DISCLAIMS ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE "AUTHORS" HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS."
+ *
+ * Please maintain this header in its entirety when copying/modifying
+ * these files.
+ *
+ *
+ */
+
+
+// Documentation for this file. If the \file tag isn't present,
+// this file won't be documented.
+/** \file
+ *  The 32-bit Timer2/3 clock behind micros() and millis().
+ *  \see pic24_time.h for more details.
+ */
+
+#include "pic24_all.h"
+#include "pic24_time.h"
+
+static volatile uint32_t u32_secondUs;   // micros() when this second began
+static volatile uint32_t u32_secondMs;   // millis() then, less ...
+static uint16_t u16_secondUsRem;         // ... these microseconds
+static uint32_t u32_usPerTickQ32;        // 2^32 us per timer tick
+static uint32_t u32_timeFcy;             // FCY the timer was set up for
+
+// Timer3 takes the period match in 32-bit mode.
+void _ISR _T3Interrupt(void) {
+  u32_secondUs += 1000000L;
+  u32_secondMs += 1000;
+  _T3IF = 0;
+}
+
+// The timer, as one 32-bit count. Reading TMR2 latches TMR3 in
+// TMR3HLD, so the two halves always go together.
+static uint32_t readTicks(void) {
+  uint16_t u16_lo = TMR2;
+
+  return ((uint32_t) TMR3HLD << 16) | u16_lo;
+}
+
+// Ticks into this second, in microseconds (less than 1000000).
+static uint32_t ticksToSecondUs(uint32_t u32_ticks) {
+  return ((uint64_t) u32_ticks * u32_usPerTickQ32) >> 32;
+}
+
+// Sets the one second period for FCY_NOW, and starts the timer from 0.
+static void startSecond(void) {
+  u32_timeFcy = FCY_NOW;
+  u32_usPerTickQ32 = (1000000ULL << 32) / u32_timeFcy;
+  PR3 = (u32_timeFcy - 1) >> 16;
+  PR2 = (u32_timeFcy - 1) & 0xFFFF;
+  TMR3HLD = 0;
+  TMR2 = 0;
+  _T3IF = 0;
+  T2CONbits.TON = 1;
+}
+
+/** Starts the clock at 0, with its interrupt at
+ *  \ref TIME32_INTERRUPT_PRIORITY. Timer2 and Timer3 are used up.
+ */
+void configTime32(void) {
+  T2CON = T2_OFF | T2_IDLE_CON | T2_GATE_OFF | T2_32BIT_MODE_ON
+          | T2_SOURCE_INT | T2_PS_1_1;
+  u32_secondUs = 0;
+  u32_secondMs = 0;
+  u16_secondUsRem = 0;
+  startSecond();
+  _T3IP = TIME32_INTERRUPT_PRIORITY;
+  _T3IE = 1;
+}
+
+/** Keeps the clock right across a change of \ref FCY_NOW: call it
+ *  straight after setClockProfile(). The ticks so far count at the old
+ *  speed (including those during the switch), and a new second starts.
+ */
+void retuneTime32(void) {
+  uint8_t u8_ie = _T3IE;
+  uint32_t u32_us;
+
+  _T3IE = 0;
+  T2CONbits.TON = 0;
+  if (_T3IF) {
+    u32_secondUs += 1000000L;
+    u32_secondMs += 1000;
+  }
+  u32_us = ticksToSecondUs(readTicks());
+  u32_secondUs += u32_us;
+  u32_us += u16_secondUsRem;
+  u32_secondMs += u32_us / 1000;
+  u16_secondUsRem = u32_us % 1000;
+  startSecond();
+  _T3IE = u8_ie;
+}
+
+/** \return Microseconds since configTime32() (wraps every 71.6
+ *  minutes).
+ */
+uint32_t micros(void) {
+  uint8_t u8_ie = _T3IE;
+  uint32_t u32_us;
+
+  _T3IE = 0;
+  u32_us = u32_secondUs + ticksToSecondUs(readTicks());
+  if (_T3IF) {
+    // the second ended, its interrupt held off: read again after it
+    u32_us = u32_secondUs + 1000000L + ticksToSecondUs(readTicks());
+  }
+  _T3IE = u8_ie;
+  return u32_us;
+}
+
+/** \return Milliseconds since configTime32() (wraps every 49.7
+ *  days).
+ */
+uint32_t millis(void) {
+  uint8_t u8_ie = _T3IE;
+  uint32_t u32_ms, u32_us;
+
+  _T3IE = 0;
+  u32_ms = u32_secondMs;
+  u32_us = ticksToSecondUs(readTicks());
+  if (_T3IF) {
+    u32_ms += 1000;
+    u32_us = ticksToSecondUs(readTicks());
+  }
+  u32_us += u16_secondUsRem;
+  _T3IE = u8_ie;
+  return u32_ms + u32_us / 1000;
+}
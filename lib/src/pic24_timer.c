@@ -52,7 +52,7 @@
  */
 uint16_t msToU16Ticks(uint16_t u16_ms, uint16_t u16_pre) {
   // Use a float internally for precision purposes to accomodate wide range of FCY, u16_pre
-  float f_ticks = FCY;
+  float f_ticks = FCY_NOW;
   uint16_t u16_ticks;
   f_ticks = (f_ticks*u16_ms)/u16_pre/1E3;
   ASSERT(f_ticks < 65535.5);
@@ -70,7 +70,7 @@ uint16_t msToU16Ticks(uint16_t u16_ms, uint16_t u16_pre) {
  */
 uint16_t usToU16Ticks(uint16_t u16_us, uint16_t u16_pre) {
   // Use a float internally for precision purposes to accomodate wide range of FCY, u16_pre
-  float f_ticks = FCY;
+  float f_ticks = FCY_NOW;
   uint16_t u16_ticks;
   f_ticks = (f_ticks*u16_us)/u16_pre/1E6;
   ASSERT(f_ticks < 65535.5);
@@ -89,7 +89,7 @@ uint16_t usToU16Ticks(uint16_t u16_us, uint16_t u16_pre) {
  */
 uint32_t usToU32Ticks(uint32_t u32_us, uint16_t u16_pre) {
   // Use a float internally for precision purposes to accomodate wide range of FCY, u16_pre.
-  float f_ticks = FCY;
+  float f_ticks = FCY_NOW;
   uint32_t u32_ticks;
   f_ticks = (f_ticks*u32_us)/u16_pre/1E6;
   u32_ticks = roundFloatToUint32(f_ticks);  //back to integer
@@ -109,7 +109,7 @@ uint32_t ticksToMs(uint32_t u32_ticks, uint16_t u16_tmrPre) {
   uint32_t u32_timeMs;
 
   f_ticks = u32_ticks;   //convert to float
-  f_ticks = ((f_ticks*u16_tmrPre)/FCY)*1E3;
+  f_ticks = ((f_ticks*u16_tmrPre)/FCY_NOW)*1E3;
   u32_timeMs = roundFloatToUint32(f_ticks);  //back to int32_t
   return u32_timeMs;
 }
@@ -126,7 +126,7 @@ uint32_t ticksToUs(uint32_t u32_ticks, uint16_t u16_tmrPre) {
   uint32_t u32_timeUs;
 
   f_ticks = u32_ticks;   //convert to float
-  f_ticks = ((f_ticks*u16_tmrPre)/FCY)*1E6;
+  f_ticks = ((f_ticks*u16_tmrPre)/FCY_NOW)*1E6;
   u32_timeUs = roundFloatToUint32(f_ticks);  //back to int32_t
   return u32_timeUs;
 }
@@ -142,7 +142,7 @@ uint32_t ticksToNs(uint32_t u32_ticks, uint16_t u16_tmrPre) {
   uint32_t u32_timeNs;
 
   f_ticks = u32_ticks;   //convert to float
-  f_ticks = ((f_ticks*u16_tmrPre)/FCY)*1E9;
+  f_ticks = ((f_ticks*u16_tmrPre)/FCY_NOW)*1E9;
   u32_timeNs = roundFloatToUint32(f_ticks);  //back to int32_t
   return u32_timeNs;
 }
@@ -309,8 +309,8 @@ void configUART1(uint32_t u32_baudRate) {
   // In particular, this clears UTXEN.
   U1MODE = (0u << 15); // UARTEN = 0 to disable.
 
-  // Configure UART baud rate, based on \ref FCY.
-  U1BRG = compute_brg(FCY, DEFAULT_BRGH1, u32_baudRate);
+  // Configure UART baud rate, based on \ref FCY_NOW.
+  U1BRG = compute_brg(FCY_NOW, DEFAULT_BRGH1, u32_baudRate);
 
   // Set up the UART mode register
   U1MODE =
@@ -699,8 +699,8 @@ void configUART2(uint32_t u32_baudRate) {
   // In particular, this clears UTXEN.
   U2MODE = (0u << 15); // UARTEN = 0 to disable.
 
-  // Configure UART baud rate, based on \ref FCY.
-  U2BRG = compute_brg(FCY, DEFAULT_BRGH2, u32_baudRate);
+  // Configure UART baud rate, based on \ref FCY_NOW.
+  U2BRG = compute_brg(FCY_NOW, DEFAULT_BRGH2, u32_baudRate);
 
   // Set up the UART mode register
   U2MODE =
@@ -1089,8 +1089,8 @@ void configUART3(uint32_t u32_baudRate) {
   // In particular, this clears UTXEN.
   U3MODE = (0u << 15); // UARTEN = 0 to disable.
 
-  // Configure UART baud rate, based on \ref FCY.
-  U3BRG = compute_brg(FCY, DEFAULT_BRGH3, u32_baudRate);
+  // Configure UART baud rate, based on \ref FCY_NOW.
+  U3BRG = compute_brg(FCY_NOW, DEFAULT_BRGH3, u32_baudRate);
 
   // Set up the UART mode register
   U3MODE =
@@ -1479,8 +1479,8 @@ void configUART4(uint32_t u32_baudRate) {
   // In particular, this clears UTXEN.
   U4MODE = (0u << 15); // UARTEN = 0 to disable.
 
-  // Configure UART baud rate, based on \ref FCY.
-  U4BRG = compute_brg(FCY, DEFAULT_BRGH4, u32_baudRate);
+  // Configure UART baud rate, based on \ref FCY_NOW.
+  U4BRG = compute_brg(FCY_NOW, DEFAULT_BRGH4, u32_baudRate);
 
   // Set up the UART mode register
   U4MODE =
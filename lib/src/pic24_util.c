@@ -55,6 +55,19 @@ void doHeartbeat(void) {
 
 void toggleHeartbeat(void) {
 }
+#elif USE_HEARTBEAT_TICK && !defined(__DOXYGEN__)
+// The system tick blinks the LED; see esos_pic24_tick.c.
+void configHeartbeat(void) {
+  CONFIG_HB_LED();
+  HB_LED = 0;
+}
+
+void doHeartbeat(void) {
+}
+
+void toggleHeartbeat(void) {
+  HB_LED = !HB_LED;
+}
 #else
 
 /** \name Heartbeat